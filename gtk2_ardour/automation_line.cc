@@ -77,6 +77,63 @@ using namespace ARDOUR;
 using namespace PBD;
 using namespace Editing;
 
+namespace {
+
+/** a model point, converted to canvas coordinates */
+struct ViewPoint {
+	ViewPoint (AutomationList::iterator m, uint32_t i, double x_, double y_)
+		: model (m), index (i), x (x_), y (y_) {}
+
+	AutomationList::iterator model;
+	uint32_t index; ///< index of the point in the model
+	double x;
+	double y;
+};
+
+/** Reduce @a column, points which all fall into the same pixel column,
+ *  to those which define what is drawn there: the first and last points
+ *  and the minimum and maximum, in their original order.
+ */
+void
+add_decimated (vector<ViewPoint> const & column, vector<ViewPoint>& decimated)
+{
+	const size_t first = 0;
+	const size_t last = column.size();
+
+	if (last <= 4) {
+		decimated.insert (decimated.end(), column.begin(), column.end());
+		return;
+	}
+
+	size_t lo = first;
+	size_t hi = first;
+
+	for (size_t n = first + 1; n < last; ++n) {
+		if (column[n].y < column[lo].y) {
+			lo = n;
+		}
+		if (column[n].y > column[hi].y) {
+			hi = n;
+		}
+	}
+
+	decimated.push_back (column[first]);
+
+	if (lo != first && lo < hi) {
+		decimated.push_back (column[lo]);
+	}
+	if (hi != first && hi != last - 1) {
+		decimated.push_back (column[hi]);
+	}
+	if (lo != first && lo != last - 1 && lo > hi) {
+		decimated.push_back (column[lo]);
+	}
+
+	decimated.push_back (column[last - 1]);
+}
+
+}
+
 /** @param converter A TimeConverter whose origin_b is the start time of the AutomationList in session samples.
  *  This will not be deleted by AutomationLine.
  */
@@ -330,6 +387,38 @@ AutomationLine::reset_line_coords (ControlPoint& cp)
 	}
 }
 
+/** @return the x position of the model point @a m in canvas units */
+double
+AutomationLine::model_to_pixel_x (AutomationList::const_iterator m) const
+{
+	return trackview.editor().sample_to_pixel_unrounded (_time_converter->to ((*m)->when) - _offset);
+}
+
+/** Add all model points between the ones of @a a and @a b to @a models.
+ *  These have no ControlPoint when the line is decimated.
+ */
+void
+AutomationLine::hidden_model_points (ControlPoint const * a, ControlPoint const * b, list<AutomationList::iterator>& models) const
+{
+	AutomationList::iterator m = a->model();
+
+	for (++m; m != b->model() && m != alist->end(); ++m) {
+		models.push_back (m);
+	}
+}
+
+/** Add all model points between the ones of @a a and @a b to @a hidden */
+void
+AutomationLine::add_hidden_drag_points (ControlPoint const * a, ControlPoint const * b, list<HiddenDragPoint>& hidden)
+{
+	list<AutomationList::iterator> models;
+	hidden_model_points (a, b, models);
+
+	for (list<AutomationList::iterator>::const_iterator m = models.begin(); m != models.end(); ++m) {
+		hidden.push_back (HiddenDragPoint (*m, model_to_pixel_x (*m), (**m)->value));
+	}
+}
+
 bool
 AutomationLine::sync_model_with_view_points (list<ControlPoint*> cp)
 {
@@ -494,8 +583,13 @@ AutomationLine::ContiguousControlPoints::compute_x_bounds (PublicEditor& e)
 		   contiguous range of control points
 		*/
 
+		/* the neighbours are the closest model points, which may
+		   have no ControlPoint when the line is decimated.
+		*/
+
 		if (front()->view_index() > 0) {
-			before_x = line.nth (front()->view_index() - 1)->get_x();
+			AutomationList::const_iterator prev = front()->model();
+			before_x = line.model_to_pixel_x (--prev);
 
 			const samplepos_t pos = e.pixel_to_sample(before_x);
 			const Meter& meter = map.meter_at_sample (pos);
@@ -511,7 +605,8 @@ AutomationLine::ContiguousControlPoints::compute_x_bounds (PublicEditor& e)
 		*/
 
 		if (back()->view_index() < (line.npoints() - 1)) {
-			after_x = line.nth (back()->view_index() + 1)->get_x();
+			AutomationList::const_iterator next = back()->model();
+			after_x = line.model_to_pixel_x (++next);
 
 			const samplepos_t pos = e.pixel_to_sample(after_x);
 			const Meter& meter = map.meter_at_sample (pos);
@@ -583,6 +678,24 @@ AutomationLine::start_drag_common (double x, float fraction)
 	/* they are probably ordered already, but we have to make sure */
 
 	_drag_points.sort (ControlPointSorter());
+
+	/* model points between two neighbouring points that are dragged
+	 * together may have been dropped by decimation. They have to move
+	 * with the line, or they would be left behind as spikes or end up
+	 * out of order.
+	 */
+
+	_hidden_drag_points.clear ();
+	_hidden_push_points.clear ();
+
+	ControlPoint const * prev = 0;
+
+	for (list<ControlPoint*>::const_iterator i = _drag_points.begin(); i != _drag_points.end(); ++i) {
+		if (prev && (*i)->view_index() == prev->view_index() + 1) {
+			add_hidden_drag_points (prev, *i, _hidden_drag_points);
+		}
+		prev = *i;
+	}
 }
 
 
@@ -632,6 +745,15 @@ AutomationLine::drag_motion (double const x, float fraction, bool ignore_x, bool
 		for (vector<CCP>::iterator ccp = contiguous_points.begin(); ccp != contiguous_points.end(); ++ccp) {
 			(*ccp)->compute_x_bounds (trackview.editor());
 		}
+
+		/* hidden points which a push moves along with the points after the drag */
+		ControlPoint const * prev = contiguous_points.back()->back();
+		ControlPoint* p;
+		for (uint32_t i = prev->view_index() + 1; (p = nth (i)) != 0 && p->can_slide(); ++i) {
+			add_hidden_drag_points (prev, p, _hidden_push_points);
+			prev = p;
+		}
+
 		_drag_had_movement = true;
 	}
 
@@ -681,6 +803,16 @@ AutomationLine::drag_motion (double const x, float fraction, bool ignore_x, bool
 			delta_value = compute_delta (orig, _desc.upper);
 		}
 	}
+	for (list<HiddenDragPoint>::const_iterator h = _hidden_drag_points.begin(); h != _hidden_drag_points.end(); ++h) {
+		double vy = h->value;
+		apply_delta (vy, delta_value);
+		if (vy < _desc.lower) {
+			delta_value = compute_delta (h->value, _desc.lower);
+		}
+		if (vy > _desc.upper) {
+			delta_value = compute_delta (h->value, _desc.upper);
+		}
+	}
 
 	if (dx || dy) {
 		/* and now move each section */
@@ -688,6 +820,11 @@ AutomationLine::drag_motion (double const x, float fraction, bool ignore_x, bool
 			(*ccp)->move (dx, delta_value);
 		}
 
+		for (list<HiddenDragPoint>::iterator h = _hidden_drag_points.begin(); h != _hidden_drag_points.end(); ++h) {
+			h->x += dx;
+			apply_delta (h->value, delta_value);
+		}
+
 		if (with_push) {
 			final_index = contiguous_points.back()->back()->view_index () + 1;
 			ControlPoint* p;
@@ -697,6 +834,9 @@ AutomationLine::drag_motion (double const x, float fraction, bool ignore_x, bool
 				reset_line_coords (*p);
 				++i;
 			}
+			for (list<HiddenDragPoint>::iterator h = _hidden_push_points.begin(); h != _hidden_push_points.end(); ++h) {
+				h->x += dx;
+			}
 		}
 
 		/* update actual line coordinates (will queue a redraw) */
@@ -738,6 +878,10 @@ AutomationLine::end_drag (bool with_push, uint32_t final_index)
 	alist->freeze ();
 	bool moved = sync_model_with_view_points (_drag_points);
 
+	for (list<HiddenDragPoint>::const_iterator h = _hidden_drag_points.begin(); h != _hidden_drag_points.end(); ++h) {
+		sync_model_with_hidden_point (*h);
+	}
+
 	if (with_push) {
 		ControlPoint* p;
 		uint32_t i = final_index;
@@ -745,6 +889,9 @@ AutomationLine::end_drag (bool with_push, uint32_t final_index)
 			moved = sync_model_with_view_point (*p) || moved;
 			++i;
 		}
+		for (list<HiddenDragPoint>::const_iterator h = _hidden_push_points.begin(); h != _hidden_push_points.end(); ++h) {
+			sync_model_with_hidden_point (*h);
+		}
 	}
 
 	alist->thaw ();
@@ -764,6 +911,25 @@ AutomationLine::end_drag (bool with_push, uint32_t final_index)
 	did_push = false;
 
 	contiguous_points.clear ();
+	_hidden_drag_points.clear ();
+	_hidden_push_points.clear ();
+}
+
+/** Move the model point of @a hp to where the drag left it */
+void
+AutomationLine::sync_model_with_hidden_point (HiddenDragPoint const & hp)
+{
+	double when = (*hp.model)->when;
+
+	/* as in sync_model_with_view_point, avoid rounding errors if x has not changed */
+	if (hp.x != model_to_pixel_x (hp.model)) {
+		when = trackview.editor().pixel_to_sample (hp.x);
+		when = _time_converter->from (when + _offset);
+	}
+
+	update_pending = true;
+
+	alist->modify (hp.model, when, hp.value);
 }
 
 bool
@@ -982,6 +1148,17 @@ AutomationLine::reset_callback (const Evoral::ControlList& events)
 
 	Evoral::ControlList& e = const_cast<Evoral::ControlList&> (events);
 
+	/* convert all points to canvas coordinates, and at the same time
+	 * reduce every run of points which fall into the same pixel column
+	 * (e.g. dense automation recorded from a fader, seen zoomed out) to
+	 * the few that make a difference to the line. Only those get a
+	 * ControlPoint.
+	 */
+
+	vector<ViewPoint> column;
+	vector<ViewPoint> points;
+	double column_x = -1;
+
 	for (AutomationList::iterator ai = e.begin(); ai != e.end(); ++ai, ++pi) {
 
 		double tx = (*ai)->when;
@@ -1013,7 +1190,21 @@ AutomationLine::reset_callback (const Evoral::ControlList& events)
 
 		ty = _height - (ty * _height);
 
-		add_visible_control_point (vp, pi, tx, ty, ai, np);
+		if (floor (tx) != column_x) {
+			add_decimated (column, points);
+			column.clear ();
+			column_x = floor (tx);
+		}
+
+		column.push_back (ViewPoint (ai, pi, tx, ty));
+	}
+
+	add_decimated (column, points);
+
+	DEBUG_TRACE (DEBUG::Automation, string_compose ("\tline %1 shows %2 of %3 points\n", _name, points.size(), np));
+
+	for (vector<ViewPoint>::const_iterator p = points.begin(); p != points.end(); ++p) {
+		add_visible_control_point (vp, p->index, p->x, p->y, p->model, np);
 		vp++;
 	}
 
@@ -1025,7 +1216,7 @@ AutomationLine::reset_callback (const Evoral::ControlList& events)
 		delete cp;
 	}
 
-	if (!terminal_points_can_slide) {
+	if (!terminal_points_can_slide && !control_points.empty()) {
 		control_points.back()->set_can_slide(false);
 	}
 
@@ -99,6 +99,8 @@ public:
 	ControlPoint const * nth (uint32_t) const;
 	uint32_t npoints() const { return control_points.size(); }
 
+	void hidden_model_points (ControlPoint const *, ControlPoint const *, std::list<ARDOUR::AutomationList::iterator>&) const;
+
 	std::string  name()    const { return _name; }
 	bool    visible() const { return _visible != VisibleAspects(0); }
 	guint32 height()  const { return _height; }
@@ -228,6 +230,20 @@ private:
 	double _drag_x; ///< last x position of the drag, in units
 	double _drag_distance; ///< total x movement of the drag, in canvas units
 	double _last_drag_fraction; ///< last y position of the drag, as a fraction
+
+	/** A model point without a ControlPoint (dropped when the line was
+	 *  decimated) which has to move along with the points being dragged.
+	 */
+	struct HiddenDragPoint {
+		HiddenDragPoint (ARDOUR::AutomationList::iterator m, double x_, double v)
+			: model (m), x (x_), value (v) {}
+		ARDOUR::AutomationList::iterator model;
+		double x;     ///< position in canvas units
+		double value; ///< value in model units
+	};
+
+	std::list<HiddenDragPoint> _hidden_drag_points; ///< hidden points between points we are dragging
+	std::list<HiddenDragPoint> _hidden_push_points; ///< hidden points which move if "push" is enabled
 	/** offset from the start of the automation list to the start of the line, so that
 	 *  a +ve offset means that the 0 on the line is at _offset in the list
 	 */
@@ -236,6 +252,9 @@ private:
 	bool is_stepped() const;
 	void update_visibility ();
 	void reset_line_coords (ControlPoint&);
+	double model_to_pixel_x (ARDOUR::AutomationList::const_iterator) const;
+	void add_hidden_drag_points (ControlPoint const *, ControlPoint const *, std::list<HiddenDragPoint>&);
+	void sync_model_with_hidden_point (HiddenDragPoint const &);
 	void add_visible_control_point (uint32_t, uint32_t, double, double, ARDOUR::AutomationList::iterator, uint32_t);
 	double control_point_box_size ();
 	void connect_to_list ();
@@ -34,7 +34,8 @@ using namespace PBD;
 PBD::Signal1<void, ControlPoint *> ControlPoint::CatchDeletion;
 
 ControlPoint::ControlPoint (AutomationLine& al)
-	: _line (al)
+	: _item (0)
+	, _line (al)
 {
 	_model = al.the_list()->end();
 	_view_index = 0;
@@ -43,19 +44,11 @@ ControlPoint::ControlPoint (AutomationLine& al)
 	_y = 0;
 	_shape = Full;
 	_size = 4.0;
-
-	_item = new ArdourCanvas::Rectangle (&_line.canvas_group());
-	_item->set_fill (true);
-	_item->set_fill_color (UIConfiguration::instance().color ("control point fill"));
-	_item->set_outline_color (UIConfiguration::instance().color ("control point outline"));
-	_item->set_data ("control_point", this);
-	_item->Event.connect (sigc::mem_fun (this, &ControlPoint::event_handler));
-
-	hide ();
 }
 
 ControlPoint::ControlPoint (const ControlPoint& other, bool /*dummy_arg_to_force_special_copy_constructor*/)
-	: _line (other._line)
+	: _item (0)
+	, _line (other._line)
 {
 	if (&other == this) {
 		return;
@@ -72,6 +65,7 @@ ControlPoint::ControlPoint (const ControlPoint& other, bool /*dummy_arg_to_force
 	_item = new ArdourCanvas::Rectangle (&_line.canvas_group());
 	_item->set_fill (true);
 	_item->set_outline_color (UIConfiguration::instance().color ("control point outline"));
+	set_item_geometry ();
 
 	/* NOTE: no event handling in copied ControlPoints */
 
@@ -85,6 +79,25 @@ ControlPoint::~ControlPoint ()
 	delete _item;
 }
 
+void
+ControlPoint::ensure_item () const
+{
+	if (_item) {
+		return;
+	}
+
+	ControlPoint* self = const_cast<ControlPoint*> (this);
+
+	_item = new ArdourCanvas::Rectangle (&_line.canvas_group());
+	_item->hide ();
+	_item->set_fill (true);
+	_item->set_data ("control_point", self);
+	_item->Event.connect (sigc::mem_fun (self, &ControlPoint::event_handler));
+
+	self->set_color ();
+	set_item_geometry ();
+}
+
 bool
 ControlPoint::event_handler (GdkEvent* event)
 {
@@ -94,19 +107,22 @@ ControlPoint::event_handler (GdkEvent* event)
 void
 ControlPoint::hide ()
 {
-	_item->hide();
+	if (_item) {
+		_item->hide();
+	}
 }
 
 void
 ControlPoint::show()
 {
+	ensure_item ();
 	_item->show();
 }
 
 bool
 ControlPoint::visible () const
 {
-	return _item->visible ();
+	return _item && _item->visible ();
 }
 
 void
@@ -120,6 +136,10 @@ ControlPoint::reset (double x, double y, AutomationList::iterator mi, uint32_t v
 void
 ControlPoint::set_color ()
 {
+	if (!_item) {
+		return;
+	}
+
 	if (_selected) {
 		_item->set_outline_color(UIConfiguration::instance().color ("control point selected outline"));;
 		_item->set_fill_color(UIConfiguration::instance().color ("control point selected fill"));
@@ -138,35 +158,44 @@ ControlPoint::set_size (double sz)
 
 void
 ControlPoint::move_to (double x, double y, ShapeType shape)
+{
+	_x = x;
+	_y = y;
+	_shape = shape;
+
+	if (_item) {
+		set_item_geometry ();
+	}
+}
+
+void
+ControlPoint::set_item_geometry () const
 {
 	double x1 = 0;
 	double x2 = 0;
 	double half_size = rint(_size/2.0);
 
-	switch (shape) {
+	switch (_shape) {
 	case Full:
-		x1 = x - half_size;
-		x2 = x + half_size;
+		x1 = _x - half_size;
+		x2 = _x + half_size;
 		break;
 	case Start:
-		x1 = x;
-		x2 = x + half_size;
+		x1 = _x;
+		x2 = _x + half_size;
 		break;
 	case End:
-		x1 = x - half_size;
-		x2 = x;
+		x1 = _x - half_size;
+		x2 = _x;
 		break;
 	}
 
-	_item->set (ArdourCanvas::Rect (x1, y - half_size, x2, y + half_size));
-
-	_x = x;
-	_y = y;
-	_shape = shape;
+	_item->set (ArdourCanvas::Rect (x1, _y - half_size, x2, _y + half_size));
 }
 
 ArdourCanvas::Item&
 ControlPoint::item() const
 {
+	ensure_item ();
 	return *_item;
 }
@@ -85,7 +85,10 @@ public:
 	static PBD::Signal1<void, ControlPoint *> CatchDeletion;
 
 private:
-	ArdourCanvas::Rectangle*        _item;
+	/* the canvas item is only created once the point is first shown (or
+	 * asked for), most points of dense automation never are.
+	 */
+	mutable ArdourCanvas::Rectangle* _item;
 	AutomationLine&                  _line;
 	ARDOUR::AutomationList::iterator _model;
 	uint32_t                         _view_index;
@@ -95,6 +98,9 @@ private:
 	double                           _size;
 	ShapeType                        _shape;
 
+	void ensure_item () const;
+	void set_item_geometry () const;
+
 	virtual bool event_handler (GdkEvent*);
 
 };
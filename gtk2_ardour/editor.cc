@@ -148,6 +148,7 @@
 #include "selection.h"
 #include "simple_progress_dialog.h"
 #include "sfdb_ui.h"
+#include "shared_meters.h"
 #include "grid_lines.h"
 #include "time_axis_view.h"
 #include "time_info_box.h"
@@ -1440,6 +1441,10 @@ Editor::set_session (Session *t)
 		sigc::mem_fun (*this, &Editor::super_rapid_screen_update)
 		);
 
+	meter_update_connection = SharedMeters::instance().connect (
+		sigc::mem_fun (*this, &Editor::update_meters)
+		);
+
 	/* register for undo history */
 	_session->register_with_memento_command_factory(id(), this);
 	_session->register_with_memento_command_factory(_selection_memento->id(), _selection_memento);
@@ -4726,6 +4731,10 @@ Editor::visual_changer (const VisualChange& vc)
 		update_tempo_based_rulers ();
 	}
 
+	if (vc.pending & VisualChange::TimeOrigin) {
+		HorizontalPositionChanged (); /* EMIT SIGNAL */
+	}
+
 	if (!(vc.pending & VisualChange::ZoomLevel)) {
 		/* If the canvas is not being zoomed then the canvas items will not change
 		 * and cause Item::prepare_for_render to be called so do it here manually.
@@ -5843,23 +5852,6 @@ Editor::super_rapid_screen_update ()
 		return;
 	}
 
-	/* METERING / MIXER STRIPS */
-
-	/* update track meters, if required */
-	if (contents().is_mapped() && meters_running) {
-		RouteTimeAxisView* rtv;
-		for (TrackViewList::iterator i = track_views.begin(); i != track_views.end(); ++i) {
-			if ((rtv = dynamic_cast<RouteTimeAxisView*>(*i)) != 0) {
-				rtv->fast_update ();
-			}
-		}
-	}
-
-	/* and any current mixer strip */
-	if (current_mixer_strip) {
-		current_mixer_strip->fast_update ();
-	}
-
 	bool latent_locate = false;
 	samplepos_t sample = _session->audible_sample (&latent_locate);
 	const int64_t now = g_get_monotonic_time ();
@@ -5995,6 +5987,7 @@ Editor::session_going_away ()
 	_session_connections.drop_connections ();
 
 	super_rapid_screen_update_connection.disconnect ();
+	meter_update_connection.disconnect ();
 
 	selection->clear ();
 	cut_buffer->clear ();
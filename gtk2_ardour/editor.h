@@ -1173,6 +1173,9 @@ private:
 
 	void super_rapid_screen_update ();
 
+	sigc::connection meter_update_connection;
+	void update_meters ();
+
 	int64_t _last_update_time;
 	double _err_screen_engine;
 
@@ -18,7 +18,9 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include "ardour/audioengine.h"
 #include "ardour/rc_configuration.h"
+#include "ardour/session.h"
 
 #include "canvas/canvas.h"
 
@@ -27,6 +29,7 @@
 #include "audio_time_axis.h"
 #include "route_time_axis.h"
 #include "audio_region_view.h"
+#include "mixer_strip.h"
 #include "selection.h"
 #include "ui_config.h"
 
@@ -51,6 +54,35 @@ Editor::start_updating_meters ()
 	meters_running = true;
 }
 
+void
+Editor::update_meters ()
+{
+	if (!_session || !_session->engine().running()) {
+		return;
+	}
+
+	/* update the meters of tracks that are on screen, if required */
+	if (contents().is_mapped() && meters_running) {
+		const double top = vertical_adjustment.get_value ();
+		const double bottom = top + vertical_adjustment.get_page_size ();
+		RouteTimeAxisView* rtv;
+
+		for (TrackViewList::iterator i = track_views.begin(); i != track_views.end(); ++i) {
+			if ((*i)->hidden () || (*i)->y_position () > bottom || (*i)->y_position () + (*i)->effective_height () < top) {
+				continue;
+			}
+			if ((rtv = dynamic_cast<RouteTimeAxisView*>(*i)) != 0) {
+				rtv->fast_update ();
+			}
+		}
+	}
+
+	/* and any current mixer strip */
+	if (current_mixer_strip) {
+		current_mixer_strip->fast_update ();
+	}
+}
+
 void
 Editor::stop_updating_meters ()
 {
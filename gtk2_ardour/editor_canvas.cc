@@ -58,6 +58,7 @@
 #include "editor_cursors.h"
 #include "mouse_cursors.h"
 #include "note_base.h"
+#include "timers.h"
 #include "ui_config.h"
 #include "verbose_cursor.h"
 
@@ -81,6 +82,12 @@ Editor::initialize_canvas ()
 	_track_canvas->set_background_color (UIConfiguration::instance().color ("arrange base"));
 	_track_canvas->use_nsglview ();
 
+	/* coalesce redraws of the many items that may change at once
+	 * (drags, undo), and post them once per screen update.
+	 */
+	_track_canvas->set_deferred_redraws (true);
+	Timers::super_rapid_connect (sigc::mem_fun (*_track_canvas, &ArdourCanvas::Canvas::flush_redraws));
+
 	/* scroll group for items that should not automatically scroll
 	 *  (e.g verbose cursor). It shares the canvas coordinate space.
 	*/
@@ -115,7 +115,9 @@ DragManager::abort ()
 		delete *i;
 	}
 
-	if (!_drags.empty ()) {
+	const bool had_drags = !_drags.empty ();
+
+	if (had_drags) {
 		_editor->set_follow_playhead (_old_follow_playhead, false);
 	}
 
@@ -123,6 +125,10 @@ DragManager::abort ()
 	_editor->abort_reversible_command();
 
 	_ending = false;
+
+	if (had_drags) {
+		_editor->DragsEnded (); /* EMIT SIGNAL */
+	}
 }
 
 void
@@ -187,6 +193,8 @@ DragManager::end_grab (GdkEvent* e)
 
 	_editor->set_follow_playhead (_old_follow_playhead, false);
 
+	_editor->DragsEnded (); /* EMIT SIGNAL */
+
 	return r;
 }
 
@@ -4330,6 +4330,25 @@ Editor::cut_copy_points (Editing::CutCopyOp op, Temporal::Beats earliest, bool m
 	/* user could select points in any order */
 	selection->points.sort(PointsSelectionPositionSorter ());
 
+	/* A decimated line (see AutomationLine::reset_callback) has no ControlPoint
+	   for some of its model points. Those between two selected neighbours are
+	   part of the selection, as they are for a drag.
+	*/
+	typedef std::list<AutomationList::iterator> HiddenEvents;
+	std::map<ControlPoint*, HiddenEvents> hidden;
+	const std::set<ControlPoint*> selected (selection->points.begin(), selection->points.end());
+
+	for (PointSelection::iterator sel_point = selection->points.begin(); sel_point != selection->points.end(); ++sel_point) {
+		ControlPoint* next = (*sel_point)->line().nth ((*sel_point)->view_index() + 1);
+		if (next && selected.find (next) != selected.end()) {
+			HiddenEvents events;
+			(*sel_point)->line().hidden_model_points (*sel_point, next, events);
+			if (!events.empty ()) {
+				hidden[*sel_point] = events;
+			}
+		}
+	}
+
 	/* Go through all selected points, making an AutomationRecord for each distinct AutomationList */
 	for (PointSelection::iterator sel_point = selection->points.begin(); sel_point != selection->points.end(); ++sel_point) {
 		const AutomationLine&                   line = (*sel_point)->line();
@@ -4357,6 +4376,14 @@ Editor::cut_copy_points (Editing::CutCopyOp op, Temporal::Beats earliest, bool m
 			AutomationList::const_iterator ctrl_evt = (*sel_point)->model ();
 
 			lists[al].copy->fast_simple_add ((*ctrl_evt)->when, (*ctrl_evt)->value);
+
+			std::map<ControlPoint*, HiddenEvents>::const_iterator h = hidden.find (*sel_point);
+			if (h != hidden.end ()) {
+				for (HiddenEvents::const_iterator e = h->second.begin(); e != h->second.end(); ++e) {
+					lists[al].copy->fast_simple_add ((**e)->when, (**e)->value);
+				}
+			}
+
 			if (midi) {
 				/* Update earliest MIDI start time in beats */
 				earliest = std::min(earliest, Temporal::Beats((*ctrl_evt)->when));
@@ -4419,6 +4446,13 @@ Editor::cut_copy_points (Editing::CutCopyOp op, Temporal::Beats earliest, bool m
 			if(erase) {
 				al->erase ((*sel_point)->model ());
 			}
+
+			std::map<ControlPoint*, HiddenEvents>::const_iterator h = hidden.find (*sel_point);
+			if (h != hidden.end ()) {
+				for (HiddenEvents::const_iterator e = h->second.begin(); e != h->second.end(); ++e) {
+					al->erase (*e);
+				}
+			}
 		}
 
 		/* Thaw the lists and add undo records for them */
@@ -4440,8 +4474,8 @@ Editor::cut_copy_midi (CutCopyOp op)
 	for (MidiRegionSelection::iterator i = selection->midi_regions.begin(); i != selection->midi_regions.end(); ++i) {
 		MidiRegionView* mrv = dynamic_cast<MidiRegionView*>(*i);
 		if (mrv) {
-			if (!mrv->selection().empty()) {
-				earliest = std::min(earliest, (*mrv->selection().begin())->note()->time());
+			if (mrv->selection_size () > 0) {
+				earliest = std::min(earliest, mrv->earliest_in_selection ());
 			}
 			mrv->cut_copy_clear (op);
 
@@ -34,6 +34,7 @@
 #include "gui_thread.h"
 #include "keyboard.h"
 #include "public_editor.h"
+#include "shared_meters.h"
 #include "ui_config.h"
 
 #include "pbd/i18n.h"
@@ -138,10 +139,17 @@ LevelMeterBase::update_meters ()
 	}
 
 	uint32_t nmidi = _meter->input_streams().n_midi();
+	MeterType meter_type = _meter->meter_type ();
+
+	float const* levels;
+	float const* peaks;
+	float const* max_peaks;
+
+	SharedMeters::instance().levels (_meter, meter_type, meters.size (), levels, peaks, max_peaks);
 
 	for (n = 0, i = meters.begin(); i != meters.end(); ++i, ++n) {
 		if ((*i).packed) {
-			const float mpeak = _meter->meter_level(n, MeterMaxPeak);
+			const float mpeak = max_peaks[n];
 			if (mpeak > (*i).max_peak) {
 				(*i).max_peak = mpeak;
 				(*i).meter->set_highlight(mpeak >= UIConfiguration::instance().get_meter_peak());
@@ -151,10 +159,9 @@ LevelMeterBase::update_meters ()
 			}
 
 			if (n < nmidi) {
-				(*i).meter->set (_meter->meter_level (n, MeterPeak));
+				(*i).meter->set (peaks[n]);
 			} else {
-				MeterType meter_type = _meter->meter_type ();
-				const float peak = _meter->meter_level (n, meter_type);
+				const float peak = levels[n];
 				if (meter_type == MeterPeak) {
 					(*i).meter->set (log_meter (peak));
 				} else if (meter_type == MeterPeak0dB) {
@@ -168,13 +175,13 @@ LevelMeterBase::update_meters ()
 				} else if (meter_type == MeterVU) {
 					(*i).meter->set (meter_deflect_vu (peak + vu_standard() + meter_lineup(0)));
 				} else if (meter_type == MeterK12) {
-					(*i).meter->set (meter_deflect_k (peak, 12), meter_deflect_k(_meter->meter_level(n, MeterPeak), 12));
+					(*i).meter->set (meter_deflect_k (peak, 12), meter_deflect_k(peaks[n], 12));
 				} else if (meter_type == MeterK14) {
-					(*i).meter->set (meter_deflect_k (peak, 14), meter_deflect_k(_meter->meter_level(n, MeterPeak), 14));
+					(*i).meter->set (meter_deflect_k (peak, 14), meter_deflect_k(peaks[n], 14));
 				} else if (meter_type == MeterK20) {
-					(*i).meter->set (meter_deflect_k (peak, 20), meter_deflect_k(_meter->meter_level(n, MeterPeak), 20));
+					(*i).meter->set (meter_deflect_k (peak, 20), meter_deflect_k(peaks[n], 20));
 				} else { // RMS
-					(*i).meter->set (log_meter (peak), log_meter(_meter->meter_level(n, MeterPeak)));
+					(*i).meter->set (log_meter (peak), log_meter(peaks[n]));
 				}
 			}
 		}
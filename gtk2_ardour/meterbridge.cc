@@ -53,7 +53,7 @@
 #include "actions.h"
 #include "gui_thread.h"
 #include "meter_patterns.h"
-#include "timers.h"
+#include "shared_meters.h"
 
 #include "pbd/i18n.h"
 
@@ -514,7 +514,7 @@ Meterbridge::get_state (void)
 gint
 Meterbridge::start_updating ()
 {
-	fast_screen_update_connection = Timers::super_rapid_connect (sigc::mem_fun(*this, &Meterbridge::fast_update_strips));
+	fast_screen_update_connection = SharedMeters::instance().connect (sigc::mem_fun(*this, &Meterbridge::fast_update_strips));
 	return 0;
 }
 
@@ -122,6 +122,8 @@ MidiRegionView::MidiRegionView (ArdourCanvas::Container*      parent,
 	, _mouse_state(None)
 	, _pressed_button(0)
 	, _optimization_iterator (_events.end())
+	, _realized_start (0)
+	, _realized_end (0)
 	, _list_editor (0)
 	, _no_sound_notes (false)
 	, _last_display_zoom (0)
@@ -170,6 +172,8 @@ MidiRegionView::MidiRegionView (ArdourCanvas::Container*      parent,
 	, _mouse_state(None)
 	, _pressed_button(0)
 	, _optimization_iterator (_events.end())
+	, _realized_start (0)
+	, _realized_end (0)
 	, _list_editor (0)
 	, _no_sound_notes (false)
 	, _last_display_zoom (0)
@@ -225,6 +229,8 @@ MidiRegionView::MidiRegionView (const MidiRegionView& other)
 	, _mouse_state(None)
 	, _pressed_button(0)
 	, _optimization_iterator (_events.end())
+	, _realized_start (0)
+	, _realized_end (0)
 	, _list_editor (0)
 	, _no_sound_notes (false)
 	, _last_display_zoom (0)
@@ -256,6 +262,8 @@ MidiRegionView::MidiRegionView (const MidiRegionView& other, boost::shared_ptr<M
 	, _mouse_state(None)
 	, _pressed_button(0)
 	, _optimization_iterator (_events.end())
+	, _realized_start (0)
+	, _realized_end (0)
 	, _list_editor (0)
 	, _no_sound_notes (false)
 	, _last_display_zoom (0)
@@ -322,6 +330,7 @@ MidiRegionView::init (bool wfd)
 
 	Config->ParameterChanged.connect (*this, invalidator (*this), boost::bind (&MidiRegionView::parameter_changed, this, _1), gui_context());
 	UIConfiguration::instance().ParameterChanged.connect (sigc::mem_fun (*this, &MidiRegionView::parameter_changed));
+	trackview.editor().HorizontalPositionChanged.connect (sigc::mem_fun (*this, &MidiRegionView::horizontal_position_changed));
 	connect_to_diskstream ();
 }
 
@@ -706,7 +715,7 @@ MidiRegionView::scroll (GdkEventScroll* ev)
 	if (trackview.editor().drags()->active()) {
 		return false;
 	}
-	if (_selection.empty()) {
+	if (selection_size () == 0) {
 		return false;
 	}
 
@@ -770,7 +779,7 @@ MidiRegionView::key_press (GdkEventKey* ev)
 
 	} else if ((ev->keyval == GDK_BackSpace || ev->keyval == GDK_Delete) && unmodified) {
 
-		if (_selection.empty()) {
+		if (selection_size () == 0) {
 			return false;
 		}
 
@@ -854,6 +863,8 @@ MidiRegionView::key_release (GdkEventKey* ev)
 void
 MidiRegionView::channel_edit ()
 {
+	realize_selection ();
+
 	if (_selection.empty()) {
 		return;
 	}
@@ -890,6 +901,8 @@ MidiRegionView::channel_edit ()
 void
 MidiRegionView::velocity_edit ()
 {
+	realize_selection ();
+
 	if (_selection.empty()) {
 		return;
 	}
@@ -1133,6 +1146,22 @@ MidiRegionView::find_canvas_note (boost::shared_ptr<NoteType> note)
 	return 0;
 }
 
+/** Find the canvas note for @a note, creating it if the note is in
+ *  this region but outside the range of notes that have canvas items.
+ */
+NoteBase*
+MidiRegionView::find_or_add_canvas_note (boost::shared_ptr<NoteType> note)
+{
+	NoteBase* cne = find_canvas_note (note);
+	bool visible;
+
+	if (!cne && note_in_region_range (note, visible)) {
+		cne = add_note (note, visible);
+	}
+
+	return cne;
+}
+
 /** This version finds any canvas note matching the supplied note. */
 NoteBase*
 MidiRegionView::find_canvas_note (Evoral::event_id_t id)
@@ -1179,7 +1208,7 @@ MidiRegionView::get_events (Events& e, Evoral::Sequence<Temporal::Beats>::NoteOp
 	_model->get_notes (notes, op, val, chan_mask);
 
 	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
-		NoteBase* cne = find_canvas_note (*n);
+		NoteBase* cne = find_or_add_canvas_note (*n);
 		if (cne) {
 			e.insert (make_pair (*n, cne));
 		}
@@ -1223,23 +1252,59 @@ MidiRegionView::redisplay_model()
 	MidiModel::ReadLock lock(_model->read_lock());
 	MidiModel::Notes& notes (_model->notes());
 
+	update_realized_range ();
+
+	/* ghosts in other lanes follow all notes, whatever their pitch */
+	const bool all_pitches = has_ghost_outside_midi_track ();
+
 	NoteBase* cne;
 	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
 
 		boost::shared_ptr<NoteType> note (*n);
 		bool visible;
 
-		if (note_in_region_range (note, visible)) {
-			if (!empty_when_starting && (cne = find_canvas_note (note)) != 0) {
-				cne->validate ();
-				if (visible) {
-					cne->show ();
-				} else {
-					cne->hide ();
+		if (!note_in_region_range (note, visible)) {
+			continue;
+		}
+
+		cne = empty_when_starting ? 0 : find_canvas_note (note);
+
+		/* notes far from the visible part of the canvas do not get
+		 * (or keep) a canvas item. Selected ones remain selected
+		 * without it, see _virtual_selection.
+		 */
+
+		const bool realized = note_in_realized_range (note);
+
+		if (!realized) {
+			if (cne && cne != _entered_note) {
+				if (cne->selected()) {
+					_selection.erase (cne);
+					_virtual_selection.insert (note);
+				}
+				continue;
+			}
+			if (!cne) {
+				if (note_pending_selection (note)) {
+					add_to_selection (note);
 				}
+				continue;
+			}
+		} else if (!visible && !all_pitches) {
+			if (cne ? !(cne->selected() || cne == _entered_note) : !note_pending_selection (note)) {
+				continue;
+			}
+		}
+
+		if (cne) {
+			cne->validate ();
+			if (visible) {
+				cne->show ();
 			} else {
-				missing_notes.insert (note);
+				cne->hide ();
 			}
+		} else {
+			missing_notes.insert (note);
 		}
 	}
 
@@ -1305,6 +1370,21 @@ MidiRegionView::redisplay_model()
 		}
 	}
 
+	/* forget selected notes which are no longer in the model */
+	if (!_virtual_selection.empty()) {
+		for (std::set< boost::shared_ptr<NoteType> >::iterator i = _virtual_selection.begin(); i != _virtual_selection.end(); ) {
+			std::pair<MidiModel::Notes::iterator, MidiModel::Notes::iterator> r = notes.equal_range (*i);
+			if (std::find (r.first, r.second, *i) == r.second) {
+				_virtual_selection.erase (i++);
+			} else {
+				++i;
+			}
+		}
+		if (_selection.empty() && _virtual_selection.empty()) {
+			trackview.editor().get_selection().remove (this);
+		}
+	}
+
 	for (vector<GhostRegion*>::iterator j = ghosts.begin(); j != ghosts.end(); ++j) {
 		MidiGhostRegion* gr = dynamic_cast<MidiGhostRegion*> (*j);
 		if (gr && !gr->trackview.hidden()) {
@@ -1321,6 +1401,96 @@ MidiRegionView::redisplay_model()
 
 }
 
+void
+MidiRegionView::update_realized_range ()
+{
+	PublicEditor& editor (trackview.editor());
+	const samplecnt_t page = editor.current_page_samples ();
+
+	_realized_start = max ((samplepos_t) 0, editor.leftmost_sample () - page);
+	_realized_end = editor.leftmost_sample () + 2 * page;
+}
+
+bool
+MidiRegionView::note_in_realized_range (const boost::shared_ptr<NoteType> note) const
+{
+	if (source_beats_to_absolute_samples (note->time ()) >= _realized_end) {
+		return false;
+	}
+
+	if (note->end_time () == std::numeric_limits<Temporal::Beats>::max ()) {
+		return true;
+	}
+
+	return source_beats_to_absolute_samples (note->end_time ()) >= _realized_start;
+}
+
+bool
+MidiRegionView::note_pending_selection (const boost::shared_ptr<NoteType> note) const
+{
+	return _marked_for_selection.find (note) != _marked_for_selection.end ()
+		|| _pending_note_selection.find (note->id ()) != _pending_note_selection.end ();
+}
+
+void
+MidiRegionView::horizontal_position_changed ()
+{
+	if (!_enable_display || _active_notes || !_model) {
+		return;
+	}
+
+	PublicEditor& editor (trackview.editor());
+	const samplepos_t left = editor.leftmost_sample ();
+	const samplepos_t right = left + editor.current_page_samples ();
+
+	if (left >= _realized_start && right <= _realized_end) {
+		/* still covered by the notes we have */
+		return;
+	}
+
+	if (_region->position () >= right || _region->position () + _region->length () <= left) {
+		/* not on screen, catch up once it is */
+		return;
+	}
+
+	if (editor.drags()->active()) {
+		/* e.g. autoscroll while dragging notes: redisplaying would reset
+		 * the position of the dragged notes, which the drag moves
+		 * incrementally. Catch up once the drag is over.
+		 */
+		if (!_redisplay_after_drag_connection.connected ()) {
+			_redisplay_after_drag_connection = editor.DragsEnded.connect (sigc::mem_fun (*this, &MidiRegionView::drags_ended));
+		}
+		return;
+	}
+
+	redisplay_model ();
+}
+
+void
+MidiRegionView::drags_ended ()
+{
+	_redisplay_after_drag_connection.disconnect ();
+	horizontal_position_changed ();
+}
+
+/** @return true if this region has a ghost in a lane other than a MIDI
+ *  track's note lane (e.g. an automation lane). Those get a ghost note for
+ *  every note in the realized range, including notes outside the visible
+ *  pitch range, which MidiGhostRegion::redisplay_model() hides itself.
+ */
+bool
+MidiRegionView::has_ghost_outside_midi_track () const
+{
+	for (vector<GhostRegion*>::const_iterator g = ghosts.begin(); g != ghosts.end(); ++g) {
+		MidiTimeAxisView* mtv = dynamic_cast<MidiTimeAxisView*> (&(*g)->trackview);
+		if (!mtv || !mtv->midi_view()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void
 MidiRegionView::display_patch_changes ()
 {
@@ -1454,6 +1624,7 @@ MidiRegionView::~MidiRegionView ()
 {
 	in_destructor = true;
 
+	_redisplay_after_drag_connection.disconnect ();
 	hide_verbose_cursor ();
 
 	delete _list_editor;
@@ -1592,6 +1763,12 @@ MidiRegionView::add_ghost (TimeAxisView& tv)
 
 	ghosts.push_back (ghost);
 	enable_display (true);
+
+	if (!mtv || !mtv->midi_view()) {
+		/* add notes outside the visible pitch range, see has_ghost_outside_midi_track () */
+		redisplay_model ();
+	}
+
 	return ghost;
 }
 
@@ -1890,6 +2067,12 @@ MidiRegionView::add_note(const boost::shared_ptr<NoteType> note, bool visible)
 			}
 		}
 
+		if (_virtual_selection.erase (note)) {
+			/* was selected while it had no canvas note */
+			_selection.insert (event);
+			event->set_selected (true);
+		}
+
 		if (_marked_for_selection.find(note) != _marked_for_selection.end()) {
 			note_selected(event, true);
 		}
@@ -1900,6 +2083,8 @@ MidiRegionView::add_note(const boost::shared_ptr<NoteType> note, bool visible)
 
 		event->on_channel_selection_change (get_selected_channels());
 		_events.insert (make_pair (event->note(), event));
+		/* inserting may rehash, which invalidates all iterators */
+		_optimization_iterator = _events.end();
 
 		if (visible) {
 			event->show();
@@ -2184,7 +2369,7 @@ MidiRegionView::note_deleted (NoteBase* cne)
 void
 MidiRegionView::delete_selection()
 {
-	if (_selection.empty()) {
+	if (_selection.empty() && _virtual_selection.empty()) {
 		return;
 	}
 
@@ -2200,7 +2385,12 @@ MidiRegionView::delete_selection()
 		}
 	}
 
+	for (std::set< boost::shared_ptr<NoteType> >::const_iterator n = _virtual_selection.begin(); n != _virtual_selection.end(); ++n) {
+		_note_diff_command->remove (*n);
+	}
+
 	_selection.clear();
+	_virtual_selection.clear();
 
 	apply_diff ();
 
@@ -2243,6 +2433,7 @@ MidiRegionView::clear_selection_internal ()
 		(*i)->hide_velocity();
 	}
 	_selection.clear();
+	_virtual_selection.clear();
 
 	if (_entered) {
 		// Clearing selection entirely, ungrab keyboard
@@ -2263,8 +2454,11 @@ MidiRegionView::select_all_notes ()
 {
 	clear_editor_note_selection ();
 
-	for (Events::iterator i = _events.begin(); i != _events.end(); ++i) {
-		add_to_selection (i->second);
+	MidiModel::ReadLock lock(_model->read_lock());
+	MidiModel::Notes& notes (_model->notes());
+
+	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
+		add_to_selection (*n);
 	}
 }
 
@@ -2273,10 +2467,13 @@ MidiRegionView::select_range (samplepos_t start, samplepos_t end)
 {
 	clear_editor_note_selection ();
 
-	for (Events::iterator i = _events.begin(); i != _events.end(); ++i) {
-		samplepos_t t = source_beats_to_absolute_samples(i->first->time());
+	MidiModel::ReadLock lock(_model->read_lock());
+	MidiModel::Notes& notes (_model->notes());
+
+	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
+		samplepos_t t = source_beats_to_absolute_samples((*n)->time());
 		if (t >= start && t <= end) {
-			add_to_selection (i->second);
+			add_to_selection (*n);
 		}
 	}
 }
@@ -2284,11 +2481,14 @@ MidiRegionView::select_range (samplepos_t start, samplepos_t end)
 void
 MidiRegionView::invert_selection ()
 {
-	for (Events::iterator i = _events.begin(); i != _events.end(); ++i) {
-		if (i->second->selected()) {
-			remove_from_selection(i->second);
+	MidiModel::ReadLock lock(_model->read_lock());
+	MidiModel::Notes& notes (_model->notes());
+
+	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
+		if (note_is_selected (*n)) {
+			remove_from_selection (*n);
 		} else {
-			add_to_selection (i->second);
+			add_to_selection (*n);
 		}
 	}
 }
@@ -2314,6 +2514,8 @@ MidiRegionView::select_notes (list<Evoral::event_id_t> notes)
 void
 MidiRegionView::select_matching_notes (uint8_t notenum, uint16_t channel_mask, bool add, bool extend)
 {
+	realize_selection ();
+
 	bool have_selection = !_selection.empty();
 	uint8_t low_note = 127;
 	uint8_t high_note = 0;
@@ -2370,7 +2572,7 @@ MidiRegionView::select_matching_notes (uint8_t notenum, uint16_t channel_mask, b
 		}
 
 		if (select) {
-			if ((cne = find_canvas_note (note)) != 0) {
+			if ((cne = find_or_add_canvas_note (note)) != 0) {
 				// extend is false because we've taken care of it,
 				// since it extends by time range, not pitch.
 				note_selected (cne, add, false);
@@ -2396,7 +2598,7 @@ MidiRegionView::toggle_matching_notes (uint8_t notenum, uint16_t channel_mask)
 		NoteBase* cne;
 
 		if (note->note() == notenum && (((0x0001 << note->channel()) & channel_mask) != 0)) {
-			if ((cne = find_canvas_note (note)) != 0) {
+			if ((cne = find_or_add_canvas_note (note)) != 0) {
 				if (cne->selected()) {
 					note_deselected (cne);
 				} else {
@@ -2444,13 +2646,16 @@ MidiRegionView::note_selected (NoteBase* ev, bool add, bool extend)
 			earliest = ev->note()->time();
 		}
 
-		for (Events::iterator i = _events.begin(); i != _events.end(); ++i) {
+		MidiModel::ReadLock lock(_model->read_lock());
+		MidiModel::Notes& notes (_model->notes());
+
+		for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
 
 			/* find notes entirely within OR spanning the earliest..latest range */
 
-			if ((i->first->time() >= earliest && i->first->end_time() <= latest) ||
-			    (i->first->time() <= earliest && i->first->end_time() >= latest)) {
-				add_to_selection (i->second);
+			if (((*n)->time() >= earliest && (*n)->end_time() <= latest) ||
+			    ((*n)->time() <= earliest && (*n)->end_time() >= latest)) {
+				add_to_selection (*n);
 			}
 		}
 	}
@@ -2521,14 +2726,19 @@ MidiRegionView::update_vertical_drag_selection (double y1, double y2, bool exten
 	// adjusting things that are in the area that appears/disappeared.
 	// We probably need a tree to be able to find events in O(log(n)) time.
 
-	for (Events::iterator i = _events.begin(); i != _events.end(); ++i) {
-		if ((i->second->y1() >= y1 && i->second->y1() <= y2)) {
+	MidiModel::ReadLock lock(_model->read_lock());
+	MidiModel::Notes& notes (_model->notes());
+
+	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
+		/* bottom edge of the note's row, as drawn by update_sustained() */
+		const double note_y1 = 1 + floor (note_to_y ((*n)->note())) + std::max (1., floor (note_height()) - 1);
+		if (note_y1 >= y1 && note_y1 <= y2) {
 			// within y- (note-) range
-			if (!i->second->selected()) {
-				add_to_selection (i->second);
+			if (!note_is_selected (*n)) {
+				add_to_selection (*n);
 			}
-		} else if (i->second->selected() && !extend) {
-			remove_from_selection (i->second);
+		} else if (!extend && note_is_selected (*n)) {
+			remove_from_selection (*n);
 		}
 	}
 }
@@ -2540,7 +2750,7 @@ MidiRegionView::remove_from_selection (NoteBase* ev)
 
 	if (i != _selection.end()) {
 		_selection.erase (i);
-		if (_selection.empty() && _grabbed_keyboard) {
+		if (_selection.empty() && _virtual_selection.empty() && _grabbed_keyboard) {
 			// Ungrab keyboard
 			Keyboard::magic_widget_drop_focus();
 			_grabbed_keyboard = false;
@@ -2550,16 +2760,94 @@ MidiRegionView::remove_from_selection (NoteBase* ev)
 	ev->set_selected (false);
 	ev->hide_velocity ();
 
-	if (_selection.empty()) {
+	if (_selection.empty() && _virtual_selection.empty()) {
 		PublicEditor& editor (trackview.editor());
 		editor.get_selection().remove (this);
 	}
 }
 
+/** Select @a note, without creating a canvas note for it if it has none */
+void
+MidiRegionView::add_to_selection (boost::shared_ptr<NoteType> note)
+{
+	NoteBase* cne = find_canvas_note (note);
+
+	if (cne) {
+		add_to_selection (cne);
+		return;
+	}
+
+	bool visible;
+
+	if (!note_in_region_range (note, visible)) {
+		return;
+	}
+
+	const bool selection_was_empty = _selection.empty() && _virtual_selection.empty();
+
+	_virtual_selection.insert (note);
+
+	if (selection_was_empty) {
+		PublicEditor& editor (trackview.editor());
+		editor.get_selection().add (this);
+	}
+}
+
+void
+MidiRegionView::remove_from_selection (boost::shared_ptr<NoteType> note)
+{
+	NoteBase* cne = find_canvas_note (note);
+
+	if (cne) {
+		remove_from_selection (cne);
+		return;
+	}
+
+	if (_virtual_selection.erase (note) && _selection.empty() && _virtual_selection.empty()) {
+		PublicEditor& editor (trackview.editor());
+		editor.get_selection().remove (this);
+	}
+}
+
+bool
+MidiRegionView::note_is_selected (boost::shared_ptr<NoteType> note)
+{
+	NoteBase* cne = find_canvas_note (note);
+
+	if (cne) {
+		return cne->selected();
+	}
+
+	return _virtual_selection.find (note) != _virtual_selection.end();
+}
+
+/** Give all selected notes a canvas note, for operations which work on those */
+void
+MidiRegionView::realize_selection ()
+{
+	if (_virtual_selection.empty()) {
+		return;
+	}
+
+	/* add_note() moves notes from _virtual_selection to _selection */
+	const std::set< boost::shared_ptr<NoteType> > notes (_virtual_selection);
+
+	for (std::set< boost::shared_ptr<NoteType> >::const_iterator n = notes.begin(); n != notes.end(); ++n) {
+		NoteBase* cne = find_or_add_canvas_note (*n);
+		if (cne && _virtual_selection.erase (*n)) {
+			_selection.insert (cne);
+			cne->set_selected (true);
+		}
+	}
+
+	/* notes which are no longer in this region */
+	_virtual_selection.clear ();
+}
+
 void
 MidiRegionView::add_to_selection (NoteBase* ev)
 {
-	const bool selection_was_empty = _selection.empty();
+	const bool selection_was_empty = _selection.empty() && _virtual_selection.empty();
 
 	if (_selection.insert (ev).second) {
 		ev->set_selected (true);
@@ -2588,12 +2876,20 @@ MidiRegionView::earliest_in_selection ()
 		}
 	}
 
+	for (std::set< boost::shared_ptr<NoteType> >::const_iterator n = _virtual_selection.begin(); n != _virtual_selection.end(); ++n) {
+		if ((*n)->time() < earliest) {
+			earliest = (*n)->time();
+		}
+	}
+
 	return earliest;
 }
 
 void
 MidiRegionView::move_selection(double dx_qn, double dy, double cumulative_dy)
 {
+	realize_selection ();
+
 	typedef vector<boost::shared_ptr<NoteType> > PossibleChord;
 	Editor* editor = dynamic_cast<Editor*> (&trackview.editor());
 	TempoMap& tmap (editor->session()->tempo_map());
@@ -2657,6 +2953,8 @@ MidiRegionView::move_selection(double dx_qn, double dy, double cumulative_dy)
 NoteBase*
 MidiRegionView::copy_selection (NoteBase* primary)
 {
+	realize_selection ();
+
 	_copy_drag_events.clear ();
 
 	if (_selection.empty()) {
@@ -2752,6 +3050,8 @@ MidiRegionView::move_copies (double dx_qn, double dy, double cumulative_dy)
 void
 MidiRegionView::note_dropped(NoteBase *, double d_qn, int8_t dnote, bool copy)
 {
+	realize_selection ();
+
 	uint8_t lowest_note_in_selection  = 127;
 	uint8_t highest_note_in_selection = 0;
 	uint8_t highest_note_difference   = 0;
@@ -2940,6 +3240,8 @@ MidiRegionView::region_samples_to_region_beats_double (samplepos_t samples) cons
 void
 MidiRegionView::begin_resizing (bool /*at_front*/)
 {
+	realize_selection ();
+
 	_resize_data.clear();
 
 	for (Selection::iterator i = _selection.begin(); i != _selection.end(); ++i) {
@@ -3356,6 +3658,8 @@ MidiRegionView::change_note_length (NoteBase* event, Temporal::Beats t)
 void
 MidiRegionView::change_velocities (bool up, bool fine, bool allow_smush, bool all_together)
 {
+	realize_selection ();
+
 	int8_t delta;
 	int8_t value = 0;
 
@@ -3417,6 +3721,8 @@ MidiRegionView::change_velocities (bool up, bool fine, bool allow_smush, bool al
 void
 MidiRegionView::transpose (bool up, bool fine, bool allow_smush)
 {
+	realize_selection ();
+
 	if (_selection.empty()) {
 		return;
 	}
@@ -3462,6 +3768,8 @@ MidiRegionView::transpose (bool up, bool fine, bool allow_smush)
 void
 MidiRegionView::change_note_lengths (bool fine, bool shorter, Temporal::Beats delta, bool start, bool end)
 {
+	realize_selection ();
+
 	if (!delta) {
 		if (fine) {
 			delta = Temporal::Beats(1.0/128.0);
@@ -3496,6 +3804,8 @@ MidiRegionView::change_note_lengths (bool fine, bool shorter, Temporal::Beats de
 void
 MidiRegionView::nudge_notes (bool forward, bool fine)
 {
+	realize_selection ();
+
 	if (_selection.empty()) {
 		return;
 	}
@@ -3565,6 +3875,8 @@ MidiRegionView::nudge_notes (bool forward, bool fine)
 void
 MidiRegionView::change_channel(uint8_t channel)
 {
+	realize_selection ();
+
 	start_note_diff_command(_("change channel"));
 	for (Selection::iterator i = _selection.begin(); i != _selection.end(); ++i) {
 		note_diff_add_change (*i, MidiModel::NoteDiffCommand::Channel, channel);
@@ -3712,7 +4024,7 @@ MidiRegionView::instrument_settings_changed ()
 void
 MidiRegionView::cut_copy_clear (Editing::CutCopyOp op)
 {
-	if (_selection.empty()) {
+	if (_selection.empty() && _virtual_selection.empty()) {
 		return;
 	}
 
@@ -3746,6 +4058,11 @@ MidiRegionView::cut_copy_clear (Editing::CutCopyOp op)
 			}
 		}
 
+		for (std::set< boost::shared_ptr<NoteType> >::const_iterator n = _virtual_selection.begin(); n != _virtual_selection.end(); ++n) {
+			_note_diff_command->remove (*n);
+		}
+		_virtual_selection.clear ();
+
 		apply_diff();
 	}
 }
@@ -3760,6 +4077,10 @@ MidiRegionView::selection_as_cut_buffer () const
 		notes.insert (boost::shared_ptr<NoteType> (new NoteType (*n)));
 	}
 
+	for (std::set< boost::shared_ptr<NoteType> >::const_iterator i = _virtual_selection.begin(); i != _virtual_selection.end(); ++i) {
+		notes.insert (boost::shared_ptr<NoteType> (new NoteType (**i)));
+	}
+
 	MidiCutBuffer* cb = new MidiCutBuffer (trackview.session());
 	cb->set (notes);
 
@@ -3872,24 +4193,28 @@ MidiRegionView::goto_next_note (bool add_to_selection)
 
 	MidiTimeAxisView* const mtv = dynamic_cast<MidiTimeAxisView*>(&trackview);
 	uint16_t const channel_mask = mtv->midi_track()->get_playback_channel_mask();
-	NoteBase* first_note = 0;
+	boost::shared_ptr<NoteType> first_note;
 
 	MidiModel::ReadLock lock(_model->read_lock());
 	MidiModel::Notes& notes (_model->notes());
 
 	for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
-		NoteBase* cne = 0;
-		if ((cne = find_canvas_note (*n))) {
+		bool visible;
+		if (note_in_region_range (*n, visible)) {
 
 			if (!first_note && (channel_mask & (1 << (*n)->channel()))) {
-				first_note = cne;
+				first_note = *n;
 			}
 
-			if (cne->selected()) {
+			/* selected notes always have a canvas note */
+			NoteBase* cne = find_canvas_note (*n);
+
+			if (cne && cne->selected()) {
 				use_next = true;
 				continue;
 			} else if (use_next) {
 				if (channel_mask & (1 << (*n)->channel())) {
+					cne = find_or_add_canvas_note (*n);
 					if (!add_to_selection) {
 						unique_select (cne);
 					} else {
@@ -3904,8 +4229,8 @@ MidiRegionView::goto_next_note (bool add_to_selection)
 
 	/* use the first one */
 
-	if (!_events.empty() && first_note) {
-		unique_select (first_note);
+	if (first_note) {
+		unique_select (find_or_add_canvas_note (first_note));
 	}
 }
 
@@ -3916,25 +4241,29 @@ MidiRegionView::goto_previous_note (bool add_to_selection)
 
 	MidiTimeAxisView* const mtv = dynamic_cast<MidiTimeAxisView*>(&trackview);
 	uint16_t const channel_mask = mtv->midi_track()->get_playback_channel_mask ();
-	NoteBase* last_note = 0;
+	boost::shared_ptr<NoteType> last_note;
 
 	MidiModel::ReadLock lock(_model->read_lock());
 	MidiModel::Notes& notes (_model->notes());
 
 	for (MidiModel::Notes::reverse_iterator n = notes.rbegin(); n != notes.rend(); ++n) {
-		NoteBase* cne = 0;
-		if ((cne = find_canvas_note (*n))) {
+		bool visible;
+		if (note_in_region_range (*n, visible)) {
 
 			if (!last_note && (channel_mask & (1 << (*n)->channel()))) {
-				last_note = cne;
+				last_note = *n;
 			}
 
-			if (cne->selected()) {
+			/* selected notes always have a canvas note */
+			NoteBase* cne = find_canvas_note (*n);
+
+			if (cne && cne->selected()) {
 				use_next = true;
 				continue;
 
 			} else if (use_next) {
 				if (channel_mask & (1 << (*n)->channel())) {
+					cne = find_or_add_canvas_note (*n);
 					if (!add_to_selection) {
 						unique_select (cne);
 					} else {
@@ -3949,8 +4278,8 @@ MidiRegionView::goto_previous_note (bool add_to_selection)
 
 	/* use the last one */
 
-	if (!_events.empty() && last_note) {
-		unique_select (last_note);
+	if (last_note) {
+		unique_select (find_or_add_canvas_note (last_note));
 	}
 }
 
@@ -3968,9 +4297,20 @@ MidiRegionView::selection_as_notelist (Notes& selected, bool allow_all_if_none_s
 		}
 	}
 
+	for (std::set< boost::shared_ptr<NoteType> >::const_iterator n = _virtual_selection.begin(); n != _virtual_selection.end(); ++n) {
+		selected.insert (*n);
+		had_selected = true;
+	}
+
 	if (allow_all_if_none_selected && !had_selected) {
-		for (Events::iterator i = _events.begin(); i != _events.end(); ++i) {
-			selected.insert (i->first);
+		MidiModel::ReadLock lock(_model->read_lock());
+		MidiModel::Notes& notes (_model->notes());
+		bool visible;
+
+		for (MidiModel::Notes::iterator n = notes.begin(); n != notes.end(); ++n) {
+			if (note_in_region_range (*n, visible)) {
+				selected.insert (*n);
+			}
 		}
 	}
 }
@@ -203,7 +203,7 @@ public:
 	void   note_deselected(NoteBase* ev);
 	void   delete_selection();
 	void   delete_note (boost::shared_ptr<NoteType>);
-	size_t selection_size() { return _selection.size(); }
+	size_t selection_size() { return _selection.size() + _virtual_selection.size(); }
 	void   select_all_notes ();
 	void   select_range(samplepos_t start, samplepos_t end);
 	void   invert_selection ();
@@ -323,7 +323,9 @@ public:
 	void show_list_editor ();
 
 	typedef std::set<NoteBase*> Selection;
-	Selection selection () const {
+	/** @return all selected notes, creating canvas notes for those which have none */
+	Selection selection () {
+		realize_selection ();
 		return _selection;
 	}
 
@@ -415,6 +417,9 @@ private:
 
 	void add_to_selection (NoteBase*);
 	void remove_from_selection (NoteBase*);
+	void add_to_selection (boost::shared_ptr<NoteType>);
+	void remove_from_selection (boost::shared_ptr<NoteType>);
+	bool note_is_selected (boost::shared_ptr<NoteType>);
 
 	std::string get_note_name (boost::shared_ptr<NoteType> note, uint8_t note_value) const;
 
@@ -457,6 +462,14 @@ private:
 	/** Currently selected NoteBase objects */
 	Selection _selection;
 
+	/** Selected notes which have no canvas note, because they are outside
+	 *  the realized range (see _realized_start). add_note() moves them
+	 *  to _selection when they get one again.
+	 */
+	std::set< boost::shared_ptr<NoteType> > _virtual_selection;
+
+	void realize_selection ();
+
 	MidiCutBuffer* selection_as_cut_buffer () const;
 
 	/** New notes (created in the current command) which should be selected
@@ -477,8 +490,28 @@ private:
 
 	NoteBase* find_canvas_note (boost::shared_ptr<NoteType>);
 	NoteBase* find_canvas_note (Evoral::event_id_t id);
+	NoteBase* find_or_add_canvas_note (boost::shared_ptr<NoteType>);
 	Events::iterator _optimization_iterator;
 
+	/** Canvas items are only created for notes (at least partially)
+	 *  within this range of session samples, which covers the visible
+	 *  part of the editor canvas and a page to either side of it.
+	 *  Selected and hovered notes keep their items wherever they are,
+	 *  other notes get one via find_or_add_canvas_note() when needed.
+	 */
+	samplepos_t _realized_start;
+	samplepos_t _realized_end;
+
+	void update_realized_range ();
+	bool note_in_realized_range (const boost::shared_ptr<NoteType>) const;
+	bool note_pending_selection (const boost::shared_ptr<NoteType>) const;
+	void horizontal_position_changed ();
+	bool has_ghost_outside_midi_track () const;
+
+	/** connected to PublicEditor::DragsEnded while a drag defers horizontal_position_changed () */
+	sigc::connection _redisplay_after_drag_connection;
+	void drags_ended ();
+
 	boost::shared_ptr<PatchChange> find_canvas_patch_change (ARDOUR::MidiModel::PatchChangePtr p);
 	boost::shared_ptr<SysEx> find_canvas_sys_ex (ARDOUR::MidiModel::SysExPtr s);
 
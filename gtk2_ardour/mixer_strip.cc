@@ -156,6 +156,14 @@ MixerStrip::MixerStrip (Mixer_UI& mx, Session* sess, boost::shared_ptr<Route> rt
 	, control_slave_ui (sess)
 {
 	init ();
+
+	if (_mixer_owned) {
+		/* processors are displayed once the strip scrolls into view,
+		 * see Mixer_UI::update_strips_in_view()
+		 */
+		set_in_view (false);
+	}
+
 	set_route (rt);
 }
 
@@ -353,6 +361,7 @@ MixerStrip::init ()
 	set_selected (false);
 
 	_packed = false;
+	_in_view = true;
 	_embedded = false;
 
 	input_button.signal_button_press_event().connect (sigc::mem_fun(*this, &MixerStrip::input_press), false);
@@ -832,6 +841,13 @@ MixerStrip::set_packed (bool yn)
 	set_gui_property ("visible", _packed);
 }
 
+void
+MixerStrip::set_in_view (bool yn)
+{
+	_in_view = yn;
+	processor_box.set_display_deferred (!yn);
+}
+
 
 struct RouteCompareByName {
 	bool operator() (boost::shared_ptr<Route> a, boost::shared_ptr<Route> b) {
@@ -156,6 +156,12 @@ protected:
 	void set_packed (bool yn);
 	bool packed () { return _packed; }
 
+	/** strips that are not in (or near) the visible part of the mixer
+	 * window do not display processors and are not metered.
+	 */
+	void set_in_view (bool yn);
+	bool in_view () const { return _in_view; }
+
 	void set_stuff_from_route ();
 
 private:
@@ -165,6 +171,7 @@ private:
 
 	bool  _embedded;
 	bool  _packed;
+	bool  _in_view;
 	bool  _mixer_owned;
 	Width _width;
 	void*  _width_owner;
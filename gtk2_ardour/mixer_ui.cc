@@ -80,7 +80,7 @@
 #include "gui_thread.h"
 #include "mixer_group_tabs.h"
 #include "route_sorter.h"
-#include "timers.h"
+#include "shared_meters.h"
 #include "ui_config.h"
 #include "vca_master_strip.h"
 
@@ -185,6 +185,9 @@ Mixer_UI::Mixer_UI ()
 
 	scroller.add (strip_group_box);
 	scroller.set_policy (Gtk::POLICY_ALWAYS, Gtk::POLICY_AUTOMATIC);
+	scroller.get_hadjustment()->signal_value_changed().connect (sigc::mem_fun (*this, &Mixer_UI::queue_update_strips_in_view));
+	scroller.get_hadjustment()->signal_changed().connect (sigc::mem_fun (*this, &Mixer_UI::queue_update_strips_in_view));
+	strip_packer.signal_size_allocate().connect (sigc::hide (sigc::mem_fun (*this, &Mixer_UI::queue_update_strips_in_view)));
 
 	setup_track_display ();
 
@@ -389,6 +392,7 @@ Mixer_UI::Mixer_UI ()
 
 Mixer_UI::~Mixer_UI ()
 {
+	strips_in_view_connection.disconnect ();
 	monitor_section_detached ();
 
 	delete foldback_strip;
@@ -675,6 +679,8 @@ Mixer_UI::add_stripables (StripableList& slist)
 	/* catch up on selection state, which we left to the editor to set */
 	sync_treeview_from_presentation_info (PropertyChange (Properties::selected));
 
+	queue_update_strips_in_view ();
+
 	if (!from_scratch) {
 		sync_presentation_info_from_treeview ();
 	}
@@ -1260,7 +1266,7 @@ Mixer_UI::hide_strip (MixerStrip* ms)
 gint
 Mixer_UI::start_updating ()
 {
-	fast_screen_update_connection = Timers::super_rapid_connect (sigc::mem_fun(*this, &Mixer_UI::fast_update_strips));
+	fast_screen_update_connection = SharedMeters::instance().connect (sigc::mem_fun(*this, &Mixer_UI::fast_update_strips));
 	return 0;
 }
 
@@ -1276,9 +1282,58 @@ Mixer_UI::fast_update_strips ()
 {
 	if (_content.is_mapped () && _session) {
 		for (list<MixerStrip *>::iterator i = strips.begin(); i != strips.end(); ++i) {
-			(*i)->fast_update ();
+			if ((*i)->in_view ()) {
+				(*i)->fast_update ();
+			}
+		}
+	}
+}
+
+void
+Mixer_UI::queue_update_strips_in_view ()
+{
+	if (!strips_in_view_connection.connected ()) {
+		strips_in_view_connection = Glib::signal_idle().connect (sigc::mem_fun (*this, &Mixer_UI::update_strips_in_view));
+	}
+}
+
+/** Strips are displayed fully when they are within a page of the visible
+ * part of the strip pane. Strips further away, and hidden strips, drop
+ * their processor entries and are not metered.
+ */
+bool
+Mixer_UI::update_strips_in_view ()
+{
+	Adjustment* adj = scroller.get_hadjustment ();
+	const double page  = adj->get_page_size ();
+	const double left  = adj->get_value () - page;
+	const double right = adj->get_value () + 2.0 * page;
+
+	for (list<MixerStrip *>::iterator i = strips.begin(); i != strips.end(); ++i) {
+		MixerStrip* strip = *i;
+
+		if (!strip->packed ()) {
+			strip->set_in_view (false);
+			continue;
+		}
+
+		if (strip->get_parent () != &strip_packer) {
+			/* master bus */
+			strip->set_in_view (true);
+			continue;
+		}
+
+		int x, y;
+
+		if (!strip->translate_coordinates (strip_group_box, 0, 0, x, y)) {
+			/* not realized yet, try again once it has been allocated */
+			continue;
 		}
+
+		strip->set_in_view (x + strip->get_width () >= left && x <= right);
 	}
+
+	return false;
 }
 
 void
@@ -3631,6 +3686,13 @@ Mixer_UI::screenshot (std::string const& filename)
 	osw.add (b);
 	b.show ();
 
+	/* the screenshot shows all strips */
+	for (list<MixerStrip *>::iterator i = strips.begin(); i != strips.end(); ++i) {
+		if ((*i)->packed ()) {
+			(*i)->set_in_view (true);
+		}
+	}
+
 	/* unpack widgets, add to OffscreenWindow */
 
 	strip_group_box.remove (strip_packer);
@@ -3692,6 +3754,7 @@ Mixer_UI::screenshot (std::string const& filename)
 		master->hide_master_spacer (false);
 		out_packer.pack_start (*master, false, false);
 	}
+	queue_update_strips_in_view ();
 	return true;
 }
 
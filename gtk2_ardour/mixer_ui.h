@@ -243,6 +243,10 @@ private:
 	sigc::connection fast_screen_update_connection;
 	void fast_update_strips ();
 
+	sigc::connection strips_in_view_connection;
+	void queue_update_strips_in_view ();
+	bool update_strips_in_view ();
+
 	void track_name_changed (MixerStrip *);
 
 	void redisplay_track_list ();
@@ -27,12 +27,12 @@
 
 #include "widgets/ardour_button.h"
 
-#include "ardour/plugin_insert.h"
+#include "ardour/processor.h"
 
 class PluginLoadStatsGui : public Gtk::Table
 {
 public:
-	PluginLoadStatsGui (boost::shared_ptr<ARDOUR::PluginInsert>);
+	PluginLoadStatsGui (boost::shared_ptr<ARDOUR::Processor>);
 
 	void start_updating ();
 	void stop_updating ();
@@ -47,7 +47,7 @@ private:
 		_insert->clear_stats ();
 	}
 
-	boost::shared_ptr<ARDOUR::PluginInsert> _insert;
+	boost::shared_ptr<ARDOUR::Processor> _insert;
 	sigc::connection update_cpu_label_connection;
 
 	Gtk::Label _lbl_min;
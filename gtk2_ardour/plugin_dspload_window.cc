@@ -196,14 +196,13 @@ void
 PluginDSPLoadWindow::add_processor_to_display (boost::weak_ptr<Processor> w, std::string const& route_name)
 {
 	boost::shared_ptr<Processor> p = w.lock ();
-	boost::shared_ptr<PluginInsert> pi = boost::dynamic_pointer_cast<PluginInsert> (p);
-	if (!pi || !pi->provides_stats ()) {
+	if (!p || !p->provides_stats ()) {
 		return;
 	}
 	p->DropReferences.connect (_processor_connections, MISSING_INVALIDATOR, boost::bind (&PluginDSPLoadWindow::refill_processors, this), gui_context());
-	PluginLoadStatsGui* plsg = new PluginLoadStatsGui (pi);
-	
-	std::string name = route_name + " - " + pi->name();
+	PluginLoadStatsGui* plsg = new PluginLoadStatsGui (p);
+
+	std::string name = route_name + " - " + p->name();
 	Gtk::Frame* frame = new Gtk::Frame (name.c_str());
 	frame->add (*Gtk::manage (plsg));
 	_box.pack_start (*frame, Gtk::PACK_SHRINK, 2);
@@ -216,8 +215,7 @@ void
 PluginDSPLoadWindow::clear_processor_stats (boost::weak_ptr<Processor> w)
 {
 	boost::shared_ptr<Processor> p = w.lock ();
-	boost::shared_ptr<PluginInsert> pi = boost::dynamic_pointer_cast<PluginInsert> (p);
-	if (pi) {
-		pi->clear_stats ();
+	if (p) {
+		p->clear_stats ();
 	}
 }
@@ -1765,6 +1765,7 @@ ProcessorBox::ProcessorBox (ARDOUR::Session* sess, boost::function<PluginSelecto
 	, _p_selection(psel)
 	, processor_display (drop_targets())
 	, _redisplay_pending (false)
+	, _display_deferred (false)
 {
 	set_session (sess);
 
@@ -2797,13 +2798,43 @@ ProcessorBox::redisplay_processors ()
 
 	processor_display.clear ();
 
-	_route->foreach_processor (sigc::mem_fun (*this, &ProcessorBox::add_processor_to_display));
+	/* window proxies are needed regardless, plugin UIs can be shown
+	 * from elsewhere (e.g. the editor's track context menu).
+	 */
 	_route->foreach_processor (sigc::mem_fun (*this, &ProcessorBox::maybe_add_processor_to_ui_list));
 	_route->foreach_processor (sigc::mem_fun (*this, &ProcessorBox::maybe_add_processor_pin_mgr));
 
+	if (_display_deferred) {
+		_redisplay_pending = true;
+		return;
+	}
+
+	_redisplay_pending = false;
+
+	_route->foreach_processor (sigc::mem_fun (*this, &ProcessorBox::add_processor_to_display));
+
 	setup_entry_positions ();
 }
 
+void
+ProcessorBox::set_display_deferred (bool yn)
+{
+	if (_display_deferred == yn) {
+		return;
+	}
+
+	_display_deferred = yn;
+
+	if (yn) {
+		if (!processor_display.children ().empty ()) {
+			processor_display.clear ();
+			_redisplay_pending = true;
+		}
+	} else if (_redisplay_pending && _route) {
+		redisplay_processors ();
+	}
+}
+
 /** Add a ProcessorWindowProxy for a processor to our list, if that processor does
  *  not already have one.
  */
@@ -417,6 +417,13 @@ public:
 	void set_route (boost::shared_ptr<ARDOUR::Route>);
 	void set_width (Width);
 
+	/** While deferred, no processor entries (and none of their widgets or
+	 * signal connections) exist, the display is built once the box is no
+	 * longer deferred. Used for mixer strips that are out of view.
+	 */
+	void set_display_deferred (bool);
+	bool display_deferred () const { return _display_deferred; }
+
 	bool processor_operation (ProcessorOperation);
 
 	void select_all_processors ();
@@ -508,6 +515,7 @@ private:
 
 	Width _width;
 	bool  _redisplay_pending;
+	bool  _display_deferred;
 
 	Gtk::Menu *processor_menu;
 	gint processor_menu_map_handler (GdkEventAny *ev);
@@ -370,6 +370,10 @@ public:
 	virtual RouteTimeAxisView* rtav_from_route (boost::shared_ptr<ARDOUR::Route>) const = 0;
 
 	sigc::signal<void> ZoomChanged;
+	/** emitted when the editor canvas is scrolled horizontally */
+	sigc::signal<void> HorizontalPositionChanged;
+	/** emitted when all drags have ended or were aborted */
+	sigc::signal<void> DragsEnded;
 	sigc::signal<void> Realized;
 	sigc::signal<void,samplepos_t> UpdateAllTransportClocks;
 
@@ -2233,6 +2233,15 @@ RCOptionEditor::RCOptionEditor ()
 
 	add_option (_("General/Session"), new UndoOptions (_rc_config));
 
+	add_option (_("General/Session"),
+	     new SpinOption<uint32_t> (
+		     "history-memory-limit",
+		     _("Limit undo history memory to (0: unlimited)"),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::get_history_memory_limit),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::set_history_memory_limit),
+		     0, 16384, 16, 256, _("MiB")
+		     ));
+
 	add_option (_("General/Session"),
 	     new BoolOption (
 		     "verify-remove-last-capture",
@@ -2251,6 +2260,16 @@ RCOptionEditor::RCOptionEditor ()
 		     sigc::mem_fun (*_rc_config, &RCConfiguration::set_periodic_safety_backups)
 		     ));
 
+	bo = new BoolOption (
+		     "binary-session-state",
+		     _("Save session files in compact binary format"),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::get_binary_session_state),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::set_binary_session_state)
+		     );
+	Gtkmm2ext::UI::instance()->set_tip (bo->tip_widget(),
+			string_compose (_("When enabled, session snapshots are written in a binary encoding that is much faster to save and load, but cannot be read by older versions of %1. Templates and archives always use XML."), PROGRAM_NAME));
+	add_option (_("General/Session"), bo);
+
 	add_option (_("General/Session"),
 	     new BoolOption (
 		     "only-copy-imported-files",
@@ -3228,6 +3247,16 @@ RCOptionEditor::RCOptionEditor ()
 		     );
 	add_option (_("Transport"), bo);
 
+	bo = new BoolOption (
+		     "cycle-trace",
+		     _("Write a process trace when an xrun occurs"),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::get_cycle_trace),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::set_cycle_trace)
+		     );
+	Gtkmm2ext::UI::instance()->set_tip (bo->tip_widget(),
+					    _("<b>When enabled</b> the most recent process cycles of all realtime threads are recorded, and written to the session folder after an xrun. The file can be viewed with chrome://tracing or https://ui.perfetto.dev"));
+	add_option (_("Transport"), bo);
+
 
 	add_option (_("Transport"), new OptionEditorHeading (_("Transport Masters")));
 
@@ -3249,6 +3278,22 @@ RCOptionEditor::RCOptionEditor ()
 
 	add_option (_("Transport"), _sync_framerate);
 
+	ComboOption<uint32_t>* rsq = new ComboOption<uint32_t> (
+		     "port-resampler-quality",
+		     _("Vari-speed resampler quality"),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::get_port_resampler_quality),
+		     sigc::mem_fun (*_rc_config, &RCConfiguration::set_port_resampler_quality)
+		     );
+	rsq->add (8, _("Low"));
+	rsq->add (12, _("Normal"));
+	rsq->add (24, _("High"));
+	rsq->add (48, _("Very high"));
+	Gtkmm2ext::UI::instance()->set_tip (rsq->tip_widget(),
+					    _("Quality of the resampling used when the transport speed is not 1.0, e.g. when chasing an external timecode source. "
+					      "Higher quality uses more CPU and adds more latency.\n\n"
+					      "This setting takes effect when the audio engine is restarted."));
+	add_option (_("Transport"), rsq);
+
 	add_option (_("Transport/LTC"), new OptionEditorHeading (_("Linear Timecode (LTC) Generator")));
 
 	add_option (_("Transport/LTC"),
@@ -3398,6 +3443,16 @@ RCOptionEditor::RCOptionEditor ()
 	Gtkmm2ext::UI::instance()->set_tip (bo->tip_widget(),
 					    _("<b>When enabled</b> plugins will be activated when they are added to tracks/busses. When disabled plugins will be left inactive when they are added to tracks/busses"));
 
+	bo = new BoolOption (
+		"processor-timing",
+			_("Measure DSP load of all processors"),
+			sigc::mem_fun (*_rc_config, &RCConfiguration::get_processor_timing),
+			sigc::mem_fun (*_rc_config, &RCConfiguration::set_processor_timing)
+			);
+	add_option (_("Plugins"), bo);
+	Gtkmm2ext::UI::instance()->set_tip (bo->tip_widget(),
+					    _("<b>When enabled</b> the DSP load of built-in processors (gain, panner, sends, disk I/O, meters) is measured in addition to plugins, and shown in the Plugin DSP Load window."));
+
 	ComboOption<uint32_t>* lna = new ComboOption<uint32_t> (
 		     "limit-n-automatables",
 		     _("Limit automatable parameters per plugin"),
@@ -20,15 +20,21 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <sstream>
+
+#include <boost/bind.hpp>
+
 #include <gtkmm/stock.h>
 #include <gtkmm2ext/utils.h>
 
 #include "pbd/memento_command.h"
 #include "pbd/convert.h"
 
+#include "ardour/analyser.h"
 #include "ardour/audioregion.h"
 #include "ardour/onset_detector.h"
 #include "ardour/session.h"
+#include "ardour/source.h"
 #include "ardour/transient_detector.h"
 
 #include "rhythm_ferret.h"
@@ -222,6 +228,60 @@ RhythmFerret::get_action () const
 	return SplitRegion;
 }
 
+RhythmFerret::AnalysisParameters
+RhythmFerret::get_analysis_parameters ()
+{
+	AnalysisParameters p;
+
+	p.mode = get_analysis_mode ();
+	p.sample_rate = _session->sample_rate ();
+
+	float dB = detection_threshold_adjustment.get_value();
+	p.threshold = dB > -80.0f ? pow (10.0f, dB * 0.05f) : 0.0f;
+	p.sensitivity = sensitivity_adjustment.get_value();
+
+	p.onset_function = p.mode == NoteOnset ? get_note_onset_function () : 0;
+	p.silence_threshold = silence_threshold_adjustment.get_value();
+	p.peak_threshold = peak_picker_threshold_adjustment.get_value();
+#ifdef HAVE_AUBIO4
+	p.minioi = minioi_adjustment.get_value();
+#else
+	p.minioi = 0;
+#endif
+	p.trigger_gap = trigger_gap_adjustment.get_value();
+
+	return p;
+}
+
+string
+RhythmFerret::AnalysisParameters::cache_key (boost::shared_ptr<AudioRegion> region) const
+{
+	/* regions are analysed without fades or gain (Readable::read),
+	 * so the result only depends on the source data in the given range.
+	 */
+	stringstream ss;
+
+	ss << "ferret:" << (int) mode << ':' << sample_rate << ':';
+
+	switch (mode) {
+	case PercussionOnset:
+		ss << threshold << ':' << sensitivity;
+		break;
+	case NoteOnset:
+		ss << onset_function << ':' << silence_threshold << ':' << peak_threshold << ':' << minioi << ':' << trigger_gap;
+		break;
+	}
+
+	SourceList const& sources (region->sources ());
+	for (SourceList::const_iterator i = sources.begin(); i != sources.end(); ++i) {
+		ss << ':' << (*i)->id().to_s();
+	}
+
+	ss << '@' << region->start() << '+' << region->length();
+
+	return ss.str();
+}
+
 void
 RhythmFerret::run_analysis ()
 {
@@ -239,41 +299,68 @@ RhythmFerret::run_analysis ()
 		return;
 	}
 
-	for (RegionSelection::iterator i = regions_with_transients.begin(); i != regions_with_transients.end(); ++i) {
+	AnalysisParameters const params (get_analysis_parameters ());
 
-		boost::shared_ptr<Readable> rd = boost::static_pointer_cast<AudioRegion> ((*i)->region());
-
-		switch (get_analysis_mode()) {
-		case PercussionOnset:
-			run_percussion_onset_analysis (rd, (*i)->region()->position(), current_results);
-			break;
-		case NoteOnset:
-			run_note_onset_analysis (rd, (*i)->region()->position(), current_results);
-			break;
-		default:
-			break;
+	/* analyse all regions concurrently, results are applied
+	 * to the regions in the GUI thread once all are done.
+	 */
+	vector<AnalysisFeatureList> results (regions_with_transients.size());
+	vector<Analyser::Job> jobs;
+
+	size_t n = 0;
+	for (RegionSelection::iterator i = regions_with_transients.begin(); i != regions_with_transients.end(); ++i, ++n) {
+		boost::shared_ptr<AudioRegion> ar = boost::dynamic_pointer_cast<AudioRegion> ((*i)->region());
+		if (ar) {
+			jobs.push_back (boost::bind (&RhythmFerret::analyse_region, boost::cref (params), ar, &results[n]));
 		}
+	}
 
-		(*i)->region()->set_onsets (current_results);
-		current_results.clear();
+	Analyser::run_parallel (jobs);
+
+	n = 0;
+	for (RegionSelection::iterator i = regions_with_transients.begin(); i != regions_with_transients.end(); ++i, ++n) {
+		(*i)->region()->set_onsets (results[n]);
+	}
+}
+
+void
+RhythmFerret::analyse_region (AnalysisParameters const& params, boost::shared_ptr<AudioRegion> region, AnalysisFeatureList* results)
+{
+	const string key = params.cache_key (region);
+
+	if (Analyser::lookup_cached_features (key, *results)) {
+		return;
+	}
+
+	int rv = -1;
+
+	switch (params.mode) {
+	case PercussionOnset:
+		rv = run_percussion_onset_analysis (params, region, *results);
+		break;
+	case NoteOnset:
+		rv = run_note_onset_analysis (params, region, *results);
+		break;
+	}
+
+	if (rv == 0) {
+		Analyser::cache_features (key, *results);
 	}
 }
 
 int
-RhythmFerret::run_percussion_onset_analysis (boost::shared_ptr<Readable> readable, sampleoffset_t /*offset*/, AnalysisFeatureList& results)
+RhythmFerret::run_percussion_onset_analysis (AnalysisParameters const& params, boost::shared_ptr<Readable> readable, AnalysisFeatureList& results)
 {
 	try {
-		TransientDetector t (_session->sample_rate());
+		TransientDetector t (params.sample_rate);
 
 		for (uint32_t i = 0; i < readable->n_channels(); ++i) {
 
 			AnalysisFeatureList these_results;
 
 			t.reset ();
-			float dB = detection_threshold_adjustment.get_value();
-			float coeff = dB > -80.0f ? pow (10.0f, dB * 0.05f) : 0.0f;
-			t.set_threshold (coeff);
-			t.set_sensitivity (4, sensitivity_adjustment.get_value());
+			t.set_threshold (params.threshold);
+			t.set_sensitivity (4, params.sensitivity);
 
 			if (t.run ("", readable.get(), i, these_results)) {
 				continue;
@@ -315,20 +402,20 @@ RhythmFerret::get_note_onset_function ()
 }
 
 int
-RhythmFerret::run_note_onset_analysis (boost::shared_ptr<Readable> readable, sampleoffset_t /*offset*/, AnalysisFeatureList& results)
+RhythmFerret::run_note_onset_analysis (AnalysisParameters const& params, boost::shared_ptr<Readable> readable, AnalysisFeatureList& results)
 {
 	try {
-		OnsetDetector t (_session->sample_rate());
+		OnsetDetector t (params.sample_rate);
 
 		for (uint32_t i = 0; i < readable->n_channels(); ++i) {
 
 			AnalysisFeatureList these_results;
 
-			t.set_function (get_note_onset_function());
-			t.set_silence_threshold (silence_threshold_adjustment.get_value());
-			t.set_peak_threshold (peak_picker_threshold_adjustment.get_value());
+			t.set_function (params.onset_function);
+			t.set_silence_threshold (params.silence_threshold);
+			t.set_peak_threshold (params.peak_threshold);
 #ifdef HAVE_AUBIO4
-			t.set_minioi (minioi_adjustment.get_value());
+			t.set_minioi (params.minioi);
 #endif
 
 			// aubio-vamp only picks up new settings on reset.
@@ -350,7 +437,7 @@ RhythmFerret::run_note_onset_analysis (boost::shared_ptr<Readable> readable, sam
 	}
 
 	if (!results.empty()) {
-		OnsetDetector::cleanup_onsets (results, _session->sample_rate(), trigger_gap_adjustment.get_value());
+		OnsetDetector::cleanup_onsets (results, params.sample_rate, params.trigger_gap);
 	}
 
 	return 0;
@@ -36,6 +36,7 @@
 #include "region_selection.h"
 
 namespace ARDOUR {
+	class AudioRegion;
 	class Readable;
 }
 
@@ -116,9 +117,31 @@ private:
 	void analysis_mode_changed ();
 	int get_note_onset_function ();
 
+	/** settings of the dialog, copied so that analysis can run
+	 * in other threads than the GUI thread
+	 */
+	struct AnalysisParameters {
+		AnalysisMode mode;
+		float        sample_rate;
+		/* percussion onset */
+		float        threshold;
+		float        sensitivity;
+		/* note onset */
+		int          onset_function;
+		float        silence_threshold;
+		float        peak_threshold;
+		float        minioi;
+		float        trigger_gap;
+
+		std::string cache_key (boost::shared_ptr<ARDOUR::AudioRegion>) const;
+	};
+
+	AnalysisParameters get_analysis_parameters ();
+
 	void run_analysis ();
-	int run_percussion_onset_analysis (boost::shared_ptr<ARDOUR::Readable> region, ARDOUR::sampleoffset_t offset, ARDOUR::AnalysisFeatureList& results);
-	int run_note_onset_analysis (boost::shared_ptr<ARDOUR::Readable> region, ARDOUR::sampleoffset_t offset, ARDOUR::AnalysisFeatureList& results);
+	static void analyse_region (AnalysisParameters const&, boost::shared_ptr<ARDOUR::AudioRegion>, ARDOUR::AnalysisFeatureList* results);
+	static int run_percussion_onset_analysis (AnalysisParameters const&, boost::shared_ptr<ARDOUR::Readable> region, ARDOUR::AnalysisFeatureList& results);
+	static int run_note_onset_analysis (AnalysisParameters const&, boost::shared_ptr<ARDOUR::Readable> region, ARDOUR::AnalysisFeatureList& results);
 
 	void do_action ();
 	void do_split_action ();
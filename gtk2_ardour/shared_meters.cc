@@ -0,0 +1,92 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ardour/meter.h"
+
+#include "shared_meters.h"
+#include "timers.h"
+
+using namespace ARDOUR;
+
+SharedMeters&
+SharedMeters::instance ()
+{
+	static SharedMeters sm;
+	return sm;
+}
+
+SharedMeters::SharedMeters ()
+	: _update (1)
+{
+	/* also needed to expire levels for meters that are updated
+	 * from elsewhere (e.g. send and return windows)
+	 */
+	_timer_connection = Timers::super_rapid_connect (sigc::mem_fun (*this, &SharedMeters::update));
+}
+
+sigc::connection
+SharedMeters::connect (sigc::slot<void> const& slot)
+{
+	return _views.connect (slot);
+}
+
+void
+SharedMeters::update ()
+{
+	/* forget meters that were not used in the previous update,
+	 * they may have been deleted since.
+	 */
+	for (Entries::iterator i = _entries.begin (); i != _entries.end ();) {
+		if (i->second.update != _update) {
+			_entries.erase (i++);
+		} else {
+			++i;
+		}
+	}
+
+	++_update;
+	_values.clear ();
+
+	_views (); /* EMIT SIGNAL */
+}
+
+void
+SharedMeters::levels (PeakMeter* meter, MeterType type, uint32_t n_channels,
+                      float const*& level, float const*& peak, float const*& max_peak)
+{
+	if (n_channels == 0) {
+		level = peak = max_peak = 0;
+		return;
+	}
+
+	Entry& e (_entries[Key (meter, type)]);
+
+	if (e.update != _update || e.n_channels < n_channels) {
+		e.update = _update;
+		e.offset = _values.size ();
+		e.n_channels = n_channels;
+
+		_values.resize (e.offset + 3 * n_channels);
+
+		float* v = &_values[0] + e.offset;
+		meter->meter_levels (type, n_channels, v, v + n_channels, v + 2 * n_channels);
+	}
+
+	float const* v = &_values[0] + e.offset;
+	level = v;
+	peak = v + e.n_channels;
+	max_peak = v + 2 * e.n_channels;
+}
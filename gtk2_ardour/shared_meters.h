@@ -0,0 +1,87 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef __gtk_ardour_shared_meters_h__
+#define __gtk_ardour_shared_meters_h__
+
+#include <map>
+#include <vector>
+
+#include <stdint.h>
+#include <sigc++/signal.h>
+
+#include "ardour/types.h"
+
+namespace ARDOUR {
+	class PeakMeter;
+}
+
+/** A single meter update pass for all views (mixer, meterbridge, editor).
+ *
+ * Views connect their meter update to this instead of a timer. On every
+ * update the levels of each PeakMeter are read at most once and kept in
+ * one contiguous array, so that a route shown in several views is only
+ * read (and converted to dB) once.
+ */
+class SharedMeters
+{
+public:
+	static SharedMeters& instance ();
+
+	/** @a slot is called once per GUI update, it should only update
+	 * meters that are visible.
+	 */
+	sigc::connection connect (sigc::slot<void> const& slot);
+
+	/** Get the levels of the first @a n_channels channels of @a meter,
+	 * see ARDOUR::PeakMeter::meter_levels(). The pointers are valid until
+	 * the next call.
+	 */
+	void levels (ARDOUR::PeakMeter* meter, ARDOUR::MeterType type, uint32_t n_channels,
+	             float const*& level, float const*& peak, float const*& max_peak);
+
+private:
+	SharedMeters ();
+
+	void update ();
+
+	struct Key {
+		Key (ARDOUR::PeakMeter* m, ARDOUR::MeterType t) : meter (m), type (t) {}
+		bool operator< (Key const& other) const {
+			return meter < other.meter || (meter == other.meter && type < other.type);
+		}
+		ARDOUR::PeakMeter* meter;
+		ARDOUR::MeterType  type;
+	};
+
+	struct Entry {
+		Entry () : update (0), offset (0), n_channels (0) {}
+		uint64_t update;
+		size_t   offset; ///< of level, followed by peak and max_peak
+		uint32_t n_channels;
+	};
+
+	typedef std::map<Key, Entry> Entries;
+
+	Entries            _entries;
+	std::vector<float> _values;
+	uint64_t           _update;
+
+	sigc::signal<void> _views;
+	sigc::connection   _timer_connection;
+};
+
+#endif /* __gtk_ardour_shared_meters_h__ */
@@ -141,6 +141,7 @@ print_help ()
 	     << "  -D, --debug <options>       Set debug flags. Use \"-D list\" to see available options\n"
 	     << "  -O, --no-hw-optimizations   Disable h/w specific optimizations\n"
 	     << "  -P, --no-connect-ports      Do not connect any ports at startup\n"
+	     << "  -T, --load-timing           Print a breakdown of the session load time\n"
 #ifdef WINDOWS_VST_SUPPORT
 	     << "  -V, --novst                 Do not use VST support\n"
 #endif
@@ -150,7 +151,7 @@ print_help ()
 int
 main (int argc, char* argv[])
 {
-	const char* optstring = "vhBdD:c:VOU:P";
+	const char* optstring = "vhBdD:c:VOU:PT";
 
 	/* clang-format off */
 	const struct option longopts[] = {
@@ -163,12 +164,14 @@ main (int argc, char* argv[])
 		{ "novst",               no_argument,       0, 'V' },
 		{ "no-hw-optimizations", no_argument,       0, 'O' },
 		{ "no-connect-ports",    no_argument,       0, 'P' },
+		{ "load-timing",         no_argument,       0, 'T' },
 		{ 0, 0, 0, 0 }
 	};
 	/* clang-format on */
 
 	bool use_vst             = true;
 	bool try_hw_optimization = true;
+	bool print_load_timing   = false;
 
 	backend_client_name = PBD::downcase (std::string (PROGRAM_NAME));
 
@@ -214,6 +217,10 @@ main (int argc, char* argv[])
 				ARDOUR::Port::set_connecting_blocked (true);
 				break;
 
+			case 'T':
+				print_load_timing = true;
+				break;
+
 			case 'V':
 #ifdef WINDOWS_VST_SUPPORT
 				use_vst = false;
@@ -265,6 +272,17 @@ main (int argc, char* argv[])
 		exit (EXIT_FAILURE);
 	}
 
+	if (print_load_timing) {
+		Session::LoadTiming const& lt (s->load_timing ());
+		uint64_t total = 0;
+		cout << "Session load time breakdown:\n";
+		for (Session::LoadTiming::const_iterator i = lt.begin (); i != lt.end (); ++i) {
+			cout << "  " << i->first << ": " << i->second / 1000 << " ms\n";
+			total += i->second;
+		}
+		cout << "  Total: " << total / 1000 << " ms" << endl;
+	}
+
 	PBD::ScopedConnectionList con;
 	BasicUI::AccessAction.connect_same_thread (con, boost::bind (&access_action, _1, _2));
 	AudioEngine::instance ()->Halted.connect_same_thread (con, boost::bind (&engine_halted, _1));
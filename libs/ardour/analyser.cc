@@ -26,7 +26,9 @@
 #include "ardour/transient_detector.h"
 
 #include "pbd/compose.h"
+#include "pbd/cpus.h"
 #include "pbd/error.h"
+#include "pbd/pthread_utils.h"
 #include "pbd/i18n.h"
 
 using namespace std;
@@ -34,10 +36,17 @@ using namespace ARDOUR;
 using namespace PBD;
 
 Analyser* Analyser::the_analyser = 0;
-Glib::Threads::Mutex Analyser::analysis_active_lock;
+Glib::Threads::RWLock Analyser::analysis_active_lock;
 Glib::Threads::Mutex Analyser::analysis_queue_lock;
 Glib::Threads::Cond  Analyser::SourcesToAnalyse;
 list<boost::weak_ptr<Source> > Analyser::analysis_queue;
+list<boost::weak_ptr<Source> > Analyser::deferred_queue;
+set<Source const*> Analyser::analysis_in_progress;
+Glib::Threads::Mutex Analyser::feature_cache_lock;
+map<string, AnalysisFeatureList> Analyser::feature_cache;
+
+/** upper limit for the number of cached results */
+static const size_t max_cached_features = 512;
 
 Analyser::Analyser ()
 {
@@ -51,13 +60,21 @@ Analyser::~Analyser ()
 static void
 analyser_work ()
 {
+	pthread_set_name ("Analyser");
 	Analyser::work ();
 }
 
 void
 Analyser::init ()
 {
-	Glib::Threads::Thread::create (sigc::ptr_fun (analyser_work));
+	/* leave some cores for the process threads, transient
+	 * analysis in the background is not time critical.
+	 */
+	const uint32_t n_threads = std::max (1U, std::min (hardware_concurrency () / 2, 8U));
+
+	for (uint32_t n = 0; n < n_threads; ++n) {
+		Glib::Threads::Thread::create (sigc::ptr_fun (analyser_work));
+	}
 }
 
 void
@@ -72,8 +89,31 @@ Analyser::queue_source_for_analysis (boost::shared_ptr<Source> src, bool force)
 	}
 
 	Glib::Threads::Mutex::Lock lm (analysis_queue_lock);
+
+	if (is_queued (analysis_queue, src) || is_queued (deferred_queue, src)) {
+		return;
+	}
+
+	if (analysis_in_progress.find (src.get()) != analysis_in_progress.end()) {
+		/* a thread is analysing it, redo once that is done */
+		deferred_queue.push_back (boost::weak_ptr<Source>(src));
+		return;
+	}
+
 	analysis_queue.push_back (boost::weak_ptr<Source>(src));
-	SourcesToAnalyse.broadcast ();
+	SourcesToAnalyse.signal ();
+}
+
+/** @return true if @a src is in @a queue, analysis_queue_lock must be held */
+bool
+Analyser::is_queued (list<boost::weak_ptr<Source> > const& queue, boost::shared_ptr<Source> src)
+{
+	for (list<boost::weak_ptr<Source> >::const_iterator i = queue.begin(); i != queue.end(); ++i) {
+		if (i->lock() == src) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void
@@ -95,14 +135,46 @@ Analyser::work ()
 
 		boost::shared_ptr<Source> src (analysis_queue.front().lock());
 		analysis_queue.pop_front();
+
+		if (!src) {
+			analysis_queue_lock.unlock ();
+			continue;
+		}
+
+		if (analysis_in_progress.find (src.get()) != analysis_in_progress.end()) {
+			/* another thread is analysing it, redo once that is done */
+			if (!is_queued (deferred_queue, src)) {
+				deferred_queue.push_back (src);
+			}
+			analysis_queue_lock.unlock ();
+			continue;
+		}
+
+		analysis_in_progress.insert (src.get());
 		analysis_queue_lock.unlock ();
 
 		boost::shared_ptr<AudioFileSource> afs = boost::dynamic_pointer_cast<AudioFileSource> (src);
 
 		if (afs && afs->length(afs->natural_position())) {
-			Glib::Threads::Mutex::Lock lm (analysis_active_lock);
+			Glib::Threads::RWLock::ReaderLock lm (analysis_active_lock);
 			analyse_audio_file_source (afs);
 		}
+
+		Glib::Threads::Mutex::Lock lq (analysis_queue_lock);
+		analysis_in_progress.erase (src.get());
+
+		/* release the request that waited for this source, if any */
+		for (list<boost::weak_ptr<Source> >::iterator i = deferred_queue.begin(); i != deferred_queue.end(); ) {
+			boost::shared_ptr<Source> d (i->lock());
+			if (!d) {
+				i = deferred_queue.erase (i);
+			} else if (d == src) {
+				analysis_queue.splice (analysis_queue.end(), deferred_queue, i++);
+				SourcesToAnalyse.signal ();
+			} else {
+				++i;
+			}
+		}
 	}
 }
 
@@ -111,6 +183,11 @@ Analyser::analyse_audio_file_source (boost::shared_ptr<AudioFileSource> src)
 {
 	AnalysisFeatureList results;
 
+	/* block statistics for region peak, RMS and loudness, so that
+	 * they are available without reading audio data later on.
+	 */
+	src->stats (true);
+
 	try {
 		TransientDetector td (src->sample_rate());
 		td.set_sensitivity (3, Config->get_transient_sensitivity()); // "General purpose"
@@ -130,6 +207,80 @@ void
 Analyser::flush ()
 {
 	Glib::Threads::Mutex::Lock lq (analysis_queue_lock);
-	Glib::Threads::Mutex::Lock la (analysis_active_lock);
+	Glib::Threads::RWLock::WriterLock la (analysis_active_lock);
 	analysis_queue.clear();
+	deferred_queue.clear();
+}
+
+namespace {
+
+struct ParallelJobs {
+	ParallelJobs (vector<Analyser::Job> const& j) : jobs (j), next (0) {}
+
+	vector<Analyser::Job> const& jobs;
+	gint next;
+};
+
+}
+
+static void
+run_jobs (ParallelJobs* pj)
+{
+	gint n;
+	while ((n = g_atomic_int_add (&pj->next, 1)) < (gint) pj->jobs.size ()) {
+		pj->jobs[n] ();
+	}
+}
+
+static void
+parallel_work (ParallelJobs* pj)
+{
+	pthread_set_name ("AnalysisWorker");
+	run_jobs (pj);
+}
+
+void
+Analyser::run_parallel (vector<Job> const& jobs)
+{
+	ParallelJobs pj (jobs);
+
+	const uint32_t n_threads = std::min ((uint32_t) jobs.size (), hardware_concurrency ());
+	vector<Glib::Threads::Thread*> threads;
+
+	for (uint32_t n = 1; n < n_threads; ++n) {
+		try {
+			threads.push_back (Glib::Threads::Thread::create (sigc::bind (sigc::ptr_fun (parallel_work), &pj)));
+		} catch (...) {
+			break;
+		}
+	}
+
+	/* the calling thread takes part, too */
+	run_jobs (&pj);
+
+	for (vector<Glib::Threads::Thread*>::iterator t = threads.begin (); t != threads.end (); ++t) {
+		(*t)->join ();
+	}
+}
+
+bool
+Analyser::lookup_cached_features (string const& key, AnalysisFeatureList& results)
+{
+	Glib::Threads::Mutex::Lock lm (feature_cache_lock);
+	map<string, AnalysisFeatureList>::const_iterator i = feature_cache.find (key);
+	if (i == feature_cache.end ()) {
+		return false;
+	}
+	results = i->second;
+	return true;
+}
+
+void
+Analyser::cache_features (string const& key, AnalysisFeatureList const& results)
+{
+	Glib::Threads::Mutex::Lock lm (feature_cache_lock);
+	if (feature_cache.size () >= max_cached_features) {
+		feature_cache.clear ();
+	}
+	feature_cache[key] = results;
 }
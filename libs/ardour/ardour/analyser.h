@@ -20,10 +20,18 @@
 #ifndef __ardour_analyser_h__
 #define __ardour_analyser_h__
 
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include <glibmm/threads.h>
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "ardour/libardour_visibility.h"
+#include "ardour/types.h"
 
 namespace ARDOUR {
 
@@ -42,12 +50,33 @@ class LIBARDOUR_API Analyser {
 	static void work ();
 	static void flush ();
 
+	typedef boost::function<void ()> Job;
+
+	/** Run all @a jobs concurrently on up to one thread per core
+	 * and return when all of them have finished. Not realtime safe.
+	 */
+	static void run_parallel (std::vector<Job> const& jobs);
+
+	/** Look up results of an earlier analysis.
+	 * @param key identifies the analysed data and the parameters
+	 * that were used, e.g. source IDs, range and plugin settings.
+	 */
+	static bool lookup_cached_features (std::string const& key, AnalysisFeatureList&);
+	static void cache_features (std::string const& key, AnalysisFeatureList const&);
+
   private:
 	static Analyser* the_analyser;
-	static Glib::Threads::Mutex analysis_active_lock;
+	static Glib::Threads::RWLock analysis_active_lock;
 	static Glib::Threads::Mutex analysis_queue_lock;
 	static Glib::Threads::Cond  SourcesToAnalyse;
 	static std::list<boost::weak_ptr<Source> > analysis_queue;
+	/** sources that are queued again while being analysed */
+	static std::list<boost::weak_ptr<Source> > deferred_queue;
+	static std::set<Source const*> analysis_in_progress;
+	static bool is_queued (std::list<boost::weak_ptr<Source> > const&, boost::shared_ptr<Source>);
+
+	static Glib::Threads::Mutex feature_cache_lock;
+	static std::map<std::string, AnalysisFeatureList> feature_cache;
 
 	static void analyse_audio_file_source (boost::shared_ptr<AudioFileSource>);
 };
@@ -48,6 +48,7 @@ public:
 
 	AudioBuffer& get_audio_buffer (pframes_t nframes);
 	void set_buffer_size (pframes_t nframes);
+	void setup_resampler ();
 
 protected:
 	friend class PortManager;
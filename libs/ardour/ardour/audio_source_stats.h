@@ -0,0 +1,96 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef __ardour_audio_source_stats_h__
+#define __ardour_audio_source_stats_h__
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "ardour/libardour_visibility.h"
+#include "ardour/types.h"
+
+namespace ARDOUR {
+
+class AudioSource;
+class Progress;
+
+/** Peak, power and loudness of a (mono) AudioSource in blocks of 100ms.
+ *
+ * The statistics are computed in a single pass over the source and
+ * stored next to its peakfile. Peak, RMS and loudness of any range of
+ * the source can then be found by combining blocks, only partial blocks
+ * at the start and end of the range need to be read from disk.
+ */
+class LIBARDOUR_API AudioSourceStats
+{
+public:
+	struct Block {
+		float peak;   ///< absolute peak
+		float power;  ///< sum of squares
+		float kpower; ///< sum of squares of the K-weighted signal (ITU-R BS.1770)
+	};
+
+	AudioSourceStats (samplecnt_t length, float sample_rate);
+
+	samplecnt_t length () const { return _length; }
+	float sample_rate () const { return _sample_rate; }
+	samplecnt_t block_size () const { return _block_size; }
+	std::vector<Block> const& blocks () const { return _blocks; }
+
+	/** @return 0 on success, -1 on error or if cancelled via @a p */
+	int compute (AudioSource const&, Progress* p = 0);
+
+	/** Add the next @a n samples of the source, e.g. while it is
+	 * written or while its peaks are built. The length grows
+	 * accordingly. Call finish() after the last samples were added.
+	 */
+	void add (Sample const* data, samplecnt_t n);
+	/** add the last, partial block */
+	void finish ();
+
+	/** @return 0 on success, -1 if the file is missing or does not
+	 * match the length and sample rate given to the constructor.
+	 */
+	int load (std::string const& path);
+	int save (std::string const& path) const;
+
+	/** Integrated loudness (ITU-R BS.1770 / EBU R128 gating) of a set of
+	 * channels, using the 100ms blocks in [first_block, first_block + n_blocks)
+	 * which must exist in all of @a channels.
+	 * @return loudness in LUFS, or -200 if the range is silent or too short.
+	 */
+	static double integrated_loudness (std::vector<AudioSourceStats const*> const& channels, size_t first_block, size_t n_blocks);
+
+private:
+	class KFilter;
+
+	samplecnt_t        _length;
+	float              _sample_rate;
+	samplecnt_t        _block_size;
+	std::vector<Block> _blocks;
+
+	/* state of add () */
+	boost::shared_ptr<KFilter> _kfilter;
+	Block                      _partial;
+	samplecnt_t                _partial_cnt;
+};
+
+} // namespace ARDOUR
+
+#endif /* __ardour_audio_source_stats_h__ */
@@ -33,6 +33,7 @@
 #include <cmath>
 #include <exception>
 #include <string>
+#include <vector>
 
 #include <glibmm/threads.h>
 
@@ -156,6 +157,23 @@ class LIBARDOUR_API AudioEngine : public PortManager, public SessionHandlePtr
 	void remove_session (); // not a replacement for SessionHandle::session_going_away()
 	Session* session() const { return _session; }
 
+	/* per-route DSP statistics, for backends that benchmark a session */
+	struct RouteProcessStats {
+		RouteProcessStats (std::string const& n, uint64_t mn, uint64_t mx, double a, double d)
+			: name (n), min (mn), max (mx), avg (a), dev (d) {}
+		std::string name;
+		uint64_t    min;
+		uint64_t    max;
+		double      avg;
+		double      dev;
+	};
+
+	/* called from the process thread */
+	bool start_route_process_stats ();
+	void stop_route_process_stats ();
+	/* must not be called from the process thread */
+	void get_route_process_stats (std::vector<RouteProcessStats>&);
+
 	class NoBackendAvailable : public std::exception {
 	    public:
 		virtual const char *what() const throw() { return "could not connect to engine backend"; }
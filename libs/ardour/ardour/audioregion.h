@@ -60,6 +60,7 @@ class Playlist;
 class Session;
 class Filter;
 class AudioSource;
+class AudioSourceStats;
 
 
 class LIBARDOUR_API AudioRegion : public Region
@@ -92,6 +93,12 @@ class LIBARDOUR_API AudioRegion : public Region
 	 */
 	double rms (Progress* p = 0) const;
 
+	/** @return the integrated loudness (EBU R128) of the region in LUFS,
+	 *  without region gain, -200 for silence, or -1000 if the Progress
+	 *  object reports that the process was cancelled.
+	 */
+	double loudness (Progress* p = 0) const;
+
 	bool envelope_active () const { return _envelope_active; }
 	bool fade_in_active ()  const { return _fade_in_active; }
 	bool fade_out_active () const { return _fade_out_active; }
@@ -218,6 +225,11 @@ class LIBARDOUR_API AudioRegion : public Region
 
 	samplecnt_t read_from_sources (SourceList const &, samplecnt_t, Sample *, samplepos_t, samplecnt_t, uint32_t) const;
 
+	typedef std::vector<boost::shared_ptr<AudioSourceStats const> > StatsList;
+
+	bool get_source_stats (StatsList&, bool force, Progress*) const;
+	bool stats_peak_and_power (uint32_t chn, AudioSourceStats const&, double& peak, double& power) const;
+
 	void recompute_at_start ();
 	void recompute_at_end ();
 
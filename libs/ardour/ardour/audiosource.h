@@ -41,6 +41,9 @@
 
 namespace ARDOUR {
 
+class AudioSourceStats;
+class Progress;
+
 class LIBARDOUR_API AudioSource : virtual public Source,
 		public ARDOUR::Readable
 {
@@ -82,6 +85,14 @@ class LIBARDOUR_API AudioSource : virtual public Source,
 	int rename_peakfile (std::string newpath);
 	void touch_peakfile ();
 
+	/** Block statistics (peak, power, loudness) of this source, which
+	 * are kept on disk next to the peakfile.
+	 * @param compute if true, compute and store them if necessary,
+	 * otherwise only return statistics that are already available.
+	 * @return 0 if there are no (up to date) statistics. Not realtime safe.
+	 */
+	boost::shared_ptr<AudioSourceStats const> stats (bool compute = false, Progress* p = 0) const;
+
 	static void set_build_missing_peakfiles (bool yn) {
 		_build_missing_peakfiles = yn;
 	}
@@ -125,6 +136,8 @@ class LIBARDOUR_API AudioSource : virtual public Source,
 	samplecnt_t           _length;
 	std::string         _peakpath;
 
+	std::string stats_path () const;
+
 	int initialize_peakfile (const std::string& path, const bool in_session = false);
 	int build_peaks_from_scratch ();
 	int compute_and_write_peaks (Sample* buf, samplecnt_t first_sample, samplecnt_t cnt,
@@ -167,6 +180,16 @@ class LIBARDOUR_API AudioSource : virtual public Source,
 	mutable off_t _last_map_off;
 	mutable size_t  _last_raw_map_length;
 	mutable boost::scoped_array<PeakData> peak_cache;
+
+	mutable Glib::Threads::Mutex _stats_lock;
+	mutable boost::shared_ptr<AudioSourceStats> _stats;
+
+	/** statistics computed from the data passed to compute_and_write_peaks () */
+	Glib::Threads::Mutex _stats_builder_lock;
+	boost::shared_ptr<AudioSourceStats> _stats_builder;
+
+	void add_to_stats (Sample const* buf, samplepos_t first_sample, samplecnt_t cnt);
+	void finish_stats (bool done);
 };
 
 }
@@ -88,6 +88,11 @@ public:
 
 	static PBD::Signal2<int,std::string,std::vector<std::string> > AmbiguousFileName;
 
+	/** Do not emit AmbiguousFileName from the calling thread; find() fails
+	 * instead. Used by threads that cannot interact with the user.
+	 */
+	static void disallow_questions_in_this_thread ();
+
 	void existence_check ();
 	virtual void prevent_deletion ();
 
@@ -27,6 +27,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include "pbd/timing.h"
+
 namespace ARDOUR
 {
 class Graph;
@@ -63,6 +65,12 @@ public:
 		finish (chain);
 	}
 
+	/** Time spent processing this node, in microseconds per cycle.
+	 * Only collected while Processor::timing_enabled ()
+	 */
+	bool get_process_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const;
+	void clear_process_stats ();
+
 private:
 	void finish (int chain);
 	void process ();
@@ -70,6 +78,9 @@ private:
 	boost::shared_ptr<Graph> _graph;
 
 	gint _refcount;
+
+	PBD::TimingStats _timing_stats;
+	volatile gint    _stat_reset;
 };
 }
 
@@ -23,10 +23,12 @@
 #define __ardour_meter_h__
 
 #include <vector>
+#include <glibmm/threads.h>
 #include "ardour/libardour_visibility.h"
 #include "ardour/types.h"
 #include "ardour/processor.h"
 #include "pbd/fastlog.h"
+#include "pbd/triple_buffer.h"
 
 #include "ardour/kmeterdsp.h"
 #include "ardour/iec1ppmdsp.h"
@@ -40,6 +42,13 @@ class ChanCount;
 class Session;
 
 /** Meters peaks on the input and stores them for access.
+ *
+ * The process thread summarizes blocks of about 10ms (peak, RMS,
+ * true-peak estimate and the readings of the K, IEC and VU meters) and
+ * publishes a summary after each block through a lock-free triple buffer.
+ * Readers (GUI, control surfaces) use meter_level() which works on a
+ * consistent snapshot. Reading has no side effects, all readers see the
+ * same levels no matter how often they poll.
  */
 class LIBARDOUR_API PeakMeter : public Processor {
 public:
@@ -77,6 +86,18 @@ public:
 
 	float meter_level (uint32_t n, MeterType type);
 
+	/** @return RMS of channel @a n over the most recent block, in dB */
+	float rms_level (uint32_t n);
+	/** @return inter-sample peak estimate of channel @a n over the most recent block, in dB */
+	float true_peak_level (uint32_t n);
+
+	/** Levels of the first @a n_channels channels from a single snapshot,
+	 * the same as calling meter_level() for every channel with @a type,
+	 * MeterPeak and MeterMaxPeak, but converted to dB in one pass.
+	 * Each of @a level, @a peak and @a max_peak must hold @a n_channels values.
+	 */
+	void meter_levels (MeterType type, uint32_t n_channels, float* level, float* peak, float* max_peak);
+
 	void set_meter_type (MeterType t);
 	MeterType meter_type () const { return _meter_type; }
 
@@ -98,11 +119,59 @@ private:
 	bool               _reset_dpm;
 	bool               _reset_max;
 
-	uint32_t           _bufcnt;
-	std::vector<float> _peak_buffer; // internal, integrate
-	std::vector<float> _peak_power;  // includes accurate falloff, hence dB
-	std::vector<float> _max_peak_signal; // dB calculation is done on demand
-	float _combined_peak; // Mackie surfaces expect the highest peak of all track channels
+	/** published levels of a channel, all linear */
+	struct ChannelLevels {
+		ChannelLevels ();
+		float peak;      ///< digital peak meter: block peaks with falloff; MIDI: level including falloff
+		float max_peak;  ///< maximum since reset_max ()
+		float rms;       ///< RMS of the block
+		float true_peak; ///< inter-sample peak estimate of the block
+		float kmeter;
+		float iec1;
+		float iec2;
+		float vu;
+	};
+
+	struct Levels {
+		Levels () : combined_peak (0) {}
+		std::vector<ChannelLevels> chn;
+		float combined_peak; // Mackie surfaces expect the highest peak of all track channels, with falloff
+	};
+
+	/** the block being measured, owned by the process thread */
+	struct BlockLevels {
+		BlockLevels ();
+		float peak;
+		float power;     ///< sum of squares
+		float true_peak;
+		float kmeter;
+		float iec1;
+		float iec2;
+		float vu;
+		float history[3]; ///< last samples of the previous cycle, for the true-peak estimate
+	};
+
+	std::vector<BlockLevels> _block;
+	float                    _block_combined_peak;
+	samplecnt_t              _block_samples;
+
+	/** owned by the process thread, published after every block */
+	Levels _levels;
+	PBD::TripleBuffer<Levels> _published;
+
+	struct ResizeLevels {
+		ResizeLevels (size_t s) : n (s) {}
+		void operator() (Levels& l) const { l.chn.resize (n); }
+		size_t n;
+	};
+
+	void measure_block (uint32_t chn, Sample const* data, pframes_t nframes);
+	void complete_block ();
+	void publish_levels ();
+	void resize_levels (size_t);
+
+	/** PBD::TripleBuffer has a single reader, serialize readers */
+	Glib::Threads::Mutex _reader_lock;
 
 	std::vector<Kmeterdsp *> _kmeter;
 	std::vector<Iec1ppmdsp *> _iec1meter;
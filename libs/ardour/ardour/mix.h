@@ -42,6 +42,9 @@ extern "C" {
 	LIBARDOUR_API void  x86_sse_avx_copy_vector          (float * dst, const float * src, uint32_t nframes);
 }
 
+LIBARDOUR_API void  x86_sse_mix_buffers_with_gain_vector     (float * dst, const float * src, const float * gain, uint32_t nframes);
+LIBARDOUR_API void  x86_sse_avx_mix_buffers_with_gain_vector (float * dst, const float * src, const float * gain, uint32_t nframes);
+
 LIBARDOUR_API void  x86_sse_find_peaks                 (const float * buf, uint32_t nsamples, float *min, float *max);
 LIBARDOUR_API void  x86_sse_avx_find_peaks             (const float * buf, uint32_t nsamples, float *min, float *max);
 
@@ -62,6 +65,7 @@ LIBARDOUR_API void veclib_find_peaks                 (const ARDOUR::Sample * buf
 LIBARDOUR_API void  veclib_apply_gain_to_buffer      (ARDOUR::Sample * buf, ARDOUR::pframes_t nframes, float gain);
 LIBARDOUR_API void  veclib_mix_buffers_with_gain     (ARDOUR::Sample * dst, const ARDOUR::Sample * src, ARDOUR::pframes_t nframes, float gain);
 LIBARDOUR_API void  veclib_mix_buffers_no_gain       (ARDOUR::Sample * dst, const ARDOUR::Sample * src, ARDOUR::pframes_t nframes);
+LIBARDOUR_API void  veclib_mix_buffers_with_gain_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, const ARDOUR::gain_t * gain, ARDOUR::pframes_t nframes);
 
 #endif
 
@@ -73,5 +77,6 @@ LIBARDOUR_API void  default_apply_gain_to_buffer      (ARDOUR::Sample * buf, ARD
 LIBARDOUR_API void  default_mix_buffers_with_gain     (ARDOUR::Sample * dst, const ARDOUR::Sample * src, ARDOUR::pframes_t nframes, float gain);
 LIBARDOUR_API void  default_mix_buffers_no_gain       (ARDOUR::Sample * dst, const ARDOUR::Sample * src, ARDOUR::pframes_t nframes);
 LIBARDOUR_API void  default_copy_vector               (ARDOUR::Sample * dst, const ARDOUR::Sample * src, ARDOUR::pframes_t nframes);
+LIBARDOUR_API void  default_mix_buffers_with_gain_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, const ARDOUR::gain_t * gain, ARDOUR::pframes_t nframes);
 
 #endif /* __ardour_mix_h__ */
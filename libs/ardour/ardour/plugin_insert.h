@@ -197,8 +197,6 @@ public:
 	bool load_preset (Plugin::PresetRecord);
 
 	bool provides_stats () const;
-	bool get_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const;
-	void clear_stats ();
 
 	/** A control that manipulates a plugin parameter (control port). */
 	struct PluginControl : public AutomationControl
@@ -432,8 +430,6 @@ private:
 
 	void preset_load_set_value (uint32_t, float);
 
-	PBD::TimingStats _timing_stats;
-	volatile gint _stat_reset;
 };
 
 } // namespace ARDOUR
@@ -124,6 +124,7 @@ public:
 	virtual void transport_stopped () {}
 	virtual void realtime_locate (bool for_loop_end) {}
 	virtual void set_buffer_size (pframes_t) {}
+	virtual void setup_resampler () {}
 
 	bool physically_connected () const;
 	uint32_t externally_connected () const { return _externally_connected; }
@@ -139,6 +140,13 @@ public:
 	static void set_speed_ratio (double s);
 	static void set_cycle_samplecnt (pframes_t n);
 
+	/** Set the filter length of the varispeed resampler, this is also its
+	 * latency. Ports use it when their resampler is set up, which is not
+	 * realtime safe, see PortManager::setup_port_resamplers().
+	 */
+	static void set_resampler_quality (uint32_t);
+	static uint32_t resampler_quality () { return _resampler_quality; }
+
 	static samplecnt_t port_offset() { return _global_port_buffer_offset; }
 	static void set_global_port_buffer_offset (pframes_t off) {
 		_global_port_buffer_offset = off;
@@ -170,7 +178,7 @@ protected:
 	LatencyRange _private_capture_latency;
 
 	static double _speed_ratio;
-	static const uint32_t _resampler_quality; /* also latency of the resampler */
+	static uint32_t   _resampler_quality; /* also latency of the resampler */
 
 private:
 	std::string _name;  ///< port short name
@@ -224,6 +224,7 @@ class LIBARDOUR_API PortManager
 	void filter_midi_ports (std::vector<std::string>&, MidiPortFlags, MidiPortFlags);
 
 	void set_port_buffer_sizes (pframes_t);
+	void setup_port_resamplers ();
 };
 
 
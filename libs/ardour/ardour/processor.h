@@ -27,6 +27,7 @@
 #include <exception>
 
 #include "pbd/statefuldestructible.h"
+#include "pbd/timing.h"
 
 #include "ardour/ardour.h"
 #include "ardour/buffer_set.h"
@@ -156,6 +157,35 @@ class LIBARDOUR_API Processor : public SessionObject, public Automatable, public
 	virtual void set_owner (SessionObject*);
 	SessionObject* owner() const;
 
+	/* DSP load statistics (in microseconds per cycle).
+	 * Plugins always collect them, other processors only while
+	 * timing is enabled (see set_timing_enabled())
+	 */
+	virtual bool provides_stats () const { return timing_enabled (); }
+	bool get_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const;
+	void clear_stats ();
+
+	static void set_timing_enabled (bool);
+	static bool timing_enabled () { return g_atomic_int_get (&_timing_enabled); }
+
+	/* called by the owning route in the process thread around run (),
+	 * only while timing is enabled */
+	void start_timing () {
+		if (_self_timed) {
+			return;
+		}
+		if (g_atomic_int_compare_and_exchange (&_stat_reset, 1, 0)) {
+			_timing_stats.reset ();
+		}
+		_timing_stats.start ();
+	}
+
+	void update_timing () {
+		if (!_self_timed) {
+			_timing_stats.update ();
+		}
+	}
+
 protected:
 	virtual XMLNode& state ();
 	virtual int set_state_2X (const XMLNode&, int version);
@@ -181,6 +211,12 @@ protected:
 	samplecnt_t _capture_offset;
 	samplecnt_t _playback_offset;
 	Location*   _loop_location;
+
+	PBD::TimingStats _timing_stats;
+	volatile gint    _stat_reset;
+	bool             _self_timed; ///< true if the processor updates _timing_stats in run()
+
+	static volatile gint _timing_enabled;
 };
 
 } // namespace ARDOUR
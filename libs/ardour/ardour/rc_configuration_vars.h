@@ -98,6 +98,7 @@ CONFIG_VARIABLE (uint32_t, disk_choice_space_threshold,  "disk-choice-space-thre
 CONFIG_VARIABLE (bool, auto_analyse_audio, "auto-analyse-audio", false)
 CONFIG_VARIABLE (float, transient_sensitivity, "transient-sensitivity", 50)
 CONFIG_VARIABLE (float, max_transport_speed, "max-transport-speed", 8.0)
+CONFIG_VARIABLE (uint32_t, port_resampler_quality, "port-resampler-quality", 12) /* 8 .. 96, see Port::set_resampler_quality() */
 
 /* OSC */
 
@@ -157,6 +158,8 @@ CONFIG_VARIABLE (bool, use_click_emphasis, "use-click-emphasis", true)
 CONFIG_VARIABLE (bool, skip_playback, "skip-playback", true)
 CONFIG_VARIABLE (bool, plugins_stop_with_transport, "plugins-stop-with-transport", false)
 CONFIG_VARIABLE (bool, stop_recording_on_xrun, "stop-recording-on-xrun", false)
+CONFIG_VARIABLE (bool, cycle_trace, "cycle-trace", false)
+CONFIG_VARIABLE (bool, processor_timing, "processor-timing", false)
 CONFIG_VARIABLE (bool, create_xrun_marker, "create-xrun-marker", true)
 CONFIG_VARIABLE (bool, stop_at_session_end, "stop-at-session-end", false)
 CONFIG_VARIABLE (float, preroll_seconds, "preroll-seconds", -2.0f)
@@ -194,8 +197,10 @@ CONFIG_VARIABLE (bool, verify_remove_last_capture, "verify-remove-last-capture",
 CONFIG_VARIABLE (bool, save_history, "save-history", true)
 CONFIG_VARIABLE (int32_t, saved_history_depth, "save-history-depth", 20)
 CONFIG_VARIABLE (int32_t, history_depth, "history-depth", 20)
+CONFIG_VARIABLE (uint32_t, history_memory_limit, "history-memory-limit", 256) /* MiB, 0: unlimited */
 CONFIG_VARIABLE (RegionEquivalence, region_equivalence, "region-equivalency", LayerTime)
 CONFIG_VARIABLE (bool, periodic_safety_backups, "periodic-safety-backups", true)
+CONFIG_VARIABLE (bool, binary_session_state, "binary-session-state", false)
 CONFIG_VARIABLE (uint32_t, periodic_safety_backup_interval, "periodic-safety-backup-interval", 120)
 CONFIG_VARIABLE (float, automation_interval_msecs, "automation-interval-msecs", 30)
 #ifdef __APPLE__
@@ -232,6 +232,13 @@ public:
 
 	boost::shared_ptr<Processor> processor_by_id (PBD::ID) const;
 
+	/** Sum of the DSP load statistics of all processors that provide them
+	 * (in microseconds per cycle). max is the sum of the individual worst
+	 * cases, dev assumes uncorrelated processors.
+	 */
+	bool get_processor_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const;
+	void clear_processor_stats ();
+
 	boost::shared_ptr<Processor> nth_plugin (uint32_t n) const;
 	boost::shared_ptr<Processor> nth_send (uint32_t n) const;
 
@@ -30,6 +30,7 @@ namespace ARDOUR {
 	typedef void  (*apply_gain_to_buffer_t)  (ARDOUR::Sample *, pframes_t, float);
 	typedef void  (*mix_buffers_with_gain_t) (ARDOUR::Sample *, const ARDOUR::Sample *, pframes_t, float);
 	typedef void  (*mix_buffers_no_gain_t)   (ARDOUR::Sample *, const ARDOUR::Sample *, pframes_t);
+	typedef void  (*mix_buffers_with_gain_vector_t) (ARDOUR::Sample *, const ARDOUR::Sample *, const ARDOUR::gain_t *, pframes_t);
 	typedef void  (*copy_vector_t)           (ARDOUR::Sample *, const ARDOUR::Sample *, pframes_t);
 
 	LIBARDOUR_API extern compute_peak_t          compute_peak;
@@ -37,6 +38,7 @@ namespace ARDOUR {
 	LIBARDOUR_API extern apply_gain_to_buffer_t  apply_gain_to_buffer;
 	LIBARDOUR_API extern mix_buffers_with_gain_t mix_buffers_with_gain;
 	LIBARDOUR_API extern mix_buffers_no_gain_t   mix_buffers_no_gain;
+	LIBARDOUR_API extern mix_buffers_with_gain_vector_t mix_buffers_with_gain_vector;
 	LIBARDOUR_API extern copy_vector_t           copy_vector;
 }
 
@@ -105,6 +105,7 @@ class Parser;
 
 namespace PBD {
 class Controllable;
+class Timing;
 }
 
 namespace luabridge {
@@ -574,6 +575,7 @@ public:
 	int save_template (const std::string& template_name, const std::string& description = "", bool replace_existing = false);
 	int save_history (std::string snapshot_name = "");
 	int restore_history (std::string snapshot_name);
+	void write_cycle_trace ();
 	void remove_state (std::string snapshot_name);
 	void rename_state (std::string old_name, std::string new_name);
 	void remove_pending_capture_state ();
@@ -603,6 +605,11 @@ public:
 	std::vector<std::string> possible_states() const;
 	static std::vector<std::string> possible_states (std::string path);
 
+	typedef std::vector<std::pair<std::string, uint64_t> > LoadTiming;
+
+	/** @return time spent (in microseconds) in each stage of loading the session state */
+	LoadTiming const& load_timing () const { return _load_timing; }
+
 	bool export_track_state (boost::shared_ptr<RouteList> rl, const std::string& path);
 
 	/// The instant xml file is written to the session directory
@@ -1831,6 +1838,9 @@ private:
 	int load_sources (const XMLNode& node);
 	XMLNode& get_sources_as_xml ();
 
+	LoadTiming _load_timing;
+	void add_load_timing (PBD::Timing&, std::string const&);
+
 	boost::shared_ptr<Source> XMLSourceFactory (const XMLNode&);
 
 	/* PLAYLISTS */
@@ -1920,6 +1930,9 @@ private:
 	int load_bundles (XMLNode const &);
 
 	UndoHistory      _history;
+	/** UndoHistory::generation() and path of the last history file written */
+	uint64_t         _saved_history_generation;
+	std::string      _saved_history_path;
 	/** current undo transaction, or 0 */
 	UndoTransaction* _current_trans;
 	/** GQuarks to describe the reversible commands that are currently in progress.
@@ -2018,6 +2031,10 @@ private:
 	XMLNode& get_control_protocol_state ();
 
 	void set_history_depth (uint32_t depth);
+	void set_history_memory_limit (uint32_t mib);
+
+	void set_cycle_trace (bool);
+	std::string cycle_trace_name (uint64_t) const;
 
 	static bool _disable_all_loaded_plugins;
 	static bool _bypass_all_loaded_plugins;
@@ -43,6 +43,16 @@ class LIBARDOUR_API SourceFactory {
 	static PBD::Signal1<void,boost::shared_ptr<Source> > SourceCreated;
 
 	static boost::shared_ptr<Source> create (Session&, const XMLNode& node, bool async = false);
+	/** Concurrently construct audio file sources for the given Source nodes,
+	 * without announcing them. @param result will hold one entry per node,
+	 * empty where a source could not be created this way (missing or
+	 * ambiguous files, nested or MIDI sources). Non-empty entries must be
+	 * passed to announce() in order.
+	 */
+	static void preload (Session&, XMLNodeList const& nodes, std::vector<boost::shared_ptr<Source> >& result);
+	/** Complete setup of a source created by preload() */
+	static int announce (boost::shared_ptr<Source>, bool async = false);
+
 	static boost::shared_ptr<Source> createSilent (Session&, const XMLNode& node,
 	                                               samplecnt_t nframes, float sample_rate);
 
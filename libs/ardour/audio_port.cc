@@ -43,8 +43,7 @@ AudioPort::AudioPort (const std::string& name, PortFlags flags)
 	, _data (0)
 {
 	assert (name.find_first_of (':') == string::npos);
-	_src.setup (_resampler_quality);
-	_src.set_rrfilt (10);
+	setup_resampler ();
 }
 
 AudioPort::~AudioPort ()
@@ -60,6 +59,13 @@ AudioPort::set_buffer_size (pframes_t nframes)
 	cache_aligned_malloc ((void**) &_data, sizeof (Sample) * lrint (floor (nframes * Config->get_max_transport_speed())));
 }
 
+void
+AudioPort::setup_resampler ()
+{
+	_src.setup (_resampler_quality);
+	_src.set_rrfilt (10);
+}
+
 void
 AudioPort::cycle_start (pframes_t nframes)
 {
@@ -0,0 +1,350 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include <boost/scoped_array.hpp>
+
+#include "pbd/compose.h"
+#include "pbd/error.h"
+#include "pbd/gstdio_compat.h"
+
+#include "ardour/audio_source_stats.h"
+#include "ardour/audiosource.h"
+#include "ardour/filename_extensions.h"
+#include "ardour/progress.h"
+#include "ardour/runtime_functions.h"
+
+#include "pbd/i18n.h"
+
+#ifdef COMPILER_MSVC
+#include <float.h>
+// C99 'isfinite()' is not available in MSVC.
+#define isfinite_local(val) (bool)_finite((double)val)
+#else
+#define isfinite_local isfinite
+#endif
+
+using namespace std;
+using namespace ARDOUR;
+using namespace PBD;
+
+static const char   stats_magic[8] = { 'A', 'R', 'D', 'S', 'T', 'A', 'T', 'S' };
+static const int32_t stats_version = 1;
+
+namespace {
+
+struct StatsHeader {
+	char    magic[8];
+	int32_t version;
+	int32_t block_size;
+	int64_t length;
+	float   sample_rate;
+	int32_t n_blocks;
+};
+
+}
+
+/** K-weighting pre-filter of ITU-R BS.1770 for any sample rate,
+ * the same as used by the EBU R128 analysis plugin (ebu_r128_proc.cc)
+ */
+class AudioSourceStats::KFilter {
+public:
+	KFilter (float fsamp)
+		: _z1 (0), _z2 (0), _z3 (0), _z4 (0)
+	{
+		float a, b, c, d, r, u1, u2, w1, w2;
+
+		r = 1 / tan (4712.3890f / fsamp);
+		w1 = r / 1.12201f;
+		w2 = r * 1.12201f;
+		u1 = u2 = 1.4085f + 210.0f / fsamp;
+		a = u1 * w1;
+		b = w1 * w1;
+		c = u2 * w2;
+		d = w2 * w2;
+		r = 1 + a + b;
+		_a0 = (1 + c + d) / r;
+		_a1 = (2 - 2 * d) / r;
+		_a2 = (1 - c + d) / r;
+		_b1 = (2 - 2 * b) / r;
+		_b2 = (1 - a + b) / r;
+		r = 48.0f / fsamp;
+		a = 4.9886075f * r;
+		b = 6.2298014f * r * r;
+		r = 1 + a + b;
+		a *= 2 / r;
+		b *= 4 / r;
+		_c3 = a + b;
+		_c4 = b;
+		r = 1.004995f / r;
+		_a0 *= r;
+		_a1 *= r;
+		_a2 *= r;
+	}
+
+	/** @return sum of squares of the filtered signal */
+	float process (Sample const* p, samplecnt_t n)
+	{
+		float z1 = _z1, z2 = _z2, z3 = _z3, z4 = _z4;
+		float s = 0;
+
+		for (samplecnt_t j = 0; j < n; ++j) {
+			const float x = p[j] - _b1 * z1 - _b2 * z2 + 1e-15f;
+			const float y = _a0 * x + _a1 * z1 + _a2 * z2 - _c3 * z3 - _c4 * z4;
+			z2 = z1;
+			z1 = x;
+			z4 += z3;
+			z3 += y;
+			s += y * y;
+		}
+
+		_z1 = isfinite_local (z1) ? z1 : 0;
+		_z2 = isfinite_local (z2) ? z2 : 0;
+		_z3 = isfinite_local (z3) ? z3 : 0;
+		_z4 = isfinite_local (z4) ? z4 : 0;
+
+		return s;
+	}
+
+private:
+	float _a0, _a1, _a2, _b1, _b2, _c3, _c4;
+	float _z1, _z2, _z3, _z4;
+};
+
+AudioSourceStats::AudioSourceStats (samplecnt_t length, float sample_rate)
+	: _length (length)
+	, _sample_rate (sample_rate)
+	, _block_size (std::max ((samplecnt_t) 1, (samplecnt_t) lrintf (sample_rate / 10.f)))
+	, _partial_cnt (0)
+{
+}
+
+void
+AudioSourceStats::add (Sample const* data, samplecnt_t n)
+{
+	if (!_kfilter) {
+		_kfilter.reset (new KFilter (_sample_rate));
+	}
+
+	_length += n;
+
+	while (n > 0) {
+		if (_partial_cnt == 0) {
+			_partial.peak = _partial.power = _partial.kpower = 0;
+		}
+
+		const samplecnt_t k = min (n, _block_size - _partial_cnt);
+
+		_partial.peak = compute_peak (data, k, _partial.peak);
+		float power = 0;
+		for (samplecnt_t i = 0; i < k; ++i) {
+			power += data[i] * data[i];
+		}
+		_partial.power += power;
+		_partial.kpower += _kfilter->process (data, k);
+
+		_partial_cnt += k;
+		data += k;
+		n -= k;
+
+		if (_partial_cnt == _block_size) {
+			_blocks.push_back (_partial);
+			_partial_cnt = 0;
+		}
+	}
+}
+
+void
+AudioSourceStats::finish ()
+{
+	if (_partial_cnt > 0) {
+		_blocks.push_back (_partial);
+		_partial_cnt = 0;
+	}
+}
+
+int
+AudioSourceStats::compute (AudioSource const& src, Progress* p)
+{
+	const samplecnt_t blocks_per_read = 16;
+	boost::scoped_array<Sample> buf (new Sample[_block_size * blocks_per_read]);
+
+	/* start over, add () counts the length up again */
+	const samplecnt_t length = _length;
+
+	_length = 0;
+	_kfilter.reset ();
+	_partial_cnt = 0;
+	_blocks.clear ();
+	_blocks.reserve ((length + _block_size - 1) / _block_size);
+
+	while (_length < length) {
+
+		const samplecnt_t to_read = min (length - _length, _block_size * blocks_per_read);
+
+		if (src.read (buf.get(), _length, to_read) != to_read) {
+			_length = length;
+			_blocks.clear ();
+			return -1;
+		}
+
+		add (buf.get(), to_read);
+
+		if (p) {
+			p->set_progress (_length / (float) length);
+			if (p->cancelled ()) {
+				_length = length;
+				_blocks.clear ();
+				return -1;
+			}
+		}
+	}
+
+	finish ();
+	return 0;
+}
+
+int
+AudioSourceStats::load (string const& path)
+{
+	FILE* f = g_fopen (path.c_str(), "rb");
+
+	if (!f) {
+		return -1;
+	}
+
+	StatsHeader h;
+	int rv = -1;
+
+	if (fread (&h, sizeof (h), 1, f) == 1
+	    && memcmp (h.magic, stats_magic, sizeof (stats_magic)) == 0
+	    && h.version == stats_version
+	    && h.block_size == _block_size
+	    && h.length == _length
+	    && h.sample_rate == _sample_rate
+	    && h.n_blocks == (_length + _block_size - 1) / _block_size) {
+
+		_blocks.resize (h.n_blocks);
+
+		if (h.n_blocks == 0 || fread (&_blocks[0], sizeof (Block), h.n_blocks, f) == (size_t) h.n_blocks) {
+			rv = 0;
+		} else {
+			_blocks.clear ();
+		}
+	}
+
+	fclose (f);
+	return rv;
+}
+
+int
+AudioSourceStats::save (string const& path) const
+{
+	/* write to a temporary file first, so that there is never a
+	 * partial file on disk that may be loaded later.
+	 */
+	const string tmp = path + temp_suffix;
+	FILE* f = g_fopen (tmp.c_str(), "wb");
+
+	if (!f) {
+		error << string_compose (_("cannot open source statistics file %1 (%2)"), tmp, strerror (errno)) << endmsg;
+		return -1;
+	}
+
+	StatsHeader h;
+	memset (&h, 0, sizeof (h));
+	memcpy (h.magic, stats_magic, sizeof (stats_magic));
+	h.version = stats_version;
+	h.block_size = _block_size;
+	h.length = _length;
+	h.sample_rate = _sample_rate;
+	h.n_blocks = _blocks.size ();
+
+	bool ok = fwrite (&h, sizeof (h), 1, f) == 1;
+
+	if (ok && !_blocks.empty ()) {
+		ok = fwrite (&_blocks[0], sizeof (Block), _blocks.size (), f) == _blocks.size ();
+	}
+
+	ok = (fclose (f) == 0) && ok;
+
+	if (!ok || g_rename (tmp.c_str(), path.c_str()) != 0) {
+		error << string_compose (_("cannot write source statistics file %1 (%2)"), path, strerror (errno)) << endmsg;
+		::g_unlink (tmp.c_str());
+		return -1;
+	}
+
+	return 0;
+}
+
+double
+AudioSourceStats::integrated_loudness (vector<AudioSourceStats const*> const& channels, size_t first_block, size_t n_blocks)
+{
+	/* gating blocks of 400ms overlap by 75% (EBU Tech 3341) */
+	if (channels.empty () || n_blocks < 4) {
+		return -200;
+	}
+
+	/* like ebu_r128_proc, a single channel counts as dual-mono */
+	const double weight = channels.size () == 1 ? 2.0 : 1.0;
+	const double window = 4.0 * channels.front ()->block_size ();
+
+	vector<double> z;
+	z.reserve (n_blocks - 3);
+
+	const double abs_gate = pow (10.0, (-70.0 + 0.691) / 10.0);
+	double sum = 0;
+
+	for (size_t j = first_block; j + 4 <= first_block + n_blocks; ++j) {
+		double power = 0;
+		for (vector<AudioSourceStats const*>::const_iterator c = channels.begin (); c != channels.end (); ++c) {
+			vector<Block> const& b ((*c)->blocks ());
+			power += b[j].kpower + b[j + 1].kpower + b[j + 2].kpower + b[j + 3].kpower;
+		}
+		power *= weight / window;
+
+		if (power > abs_gate) {
+			z.push_back (power);
+			sum += power;
+		}
+	}
+
+	if (z.empty ()) {
+		return -200;
+	}
+
+	/* relative gate: 10 LU below the loudness of the blocks above the absolute gate */
+	const double rel_gate = sum / z.size () * 0.1;
+	size_t n = 0;
+	sum = 0;
+
+	for (vector<double>::const_iterator i = z.begin (); i != z.end (); ++i) {
+		if (*i > rel_gate) {
+			sum += *i;
+			++n;
+		}
+	}
+
+	if (n == 0) {
+		return -200;
+	}
+
+	return -0.691 + 10.0 * log10 (sum / n);
+}
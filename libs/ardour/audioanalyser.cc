@@ -26,6 +26,7 @@
 #include "pbd/gstdio_compat.h"
 #include <glibmm/miscutils.h>
 #include <glibmm/fileutils.h>
+#include <glibmm/threads.h>
 
 #include "pbd/error.h"
 #include "pbd/failed_constructor.h"
@@ -42,6 +43,9 @@ using namespace Vamp;
 using namespace PBD;
 using namespace ARDOUR;
 
+/* analysers may be created concurrently by the Analyser threads */
+static Glib::Threads::Mutex loader_lock;
+
 AudioAnalyser::AudioAnalyser (float sr, AnalysisPluginKey key)
 	: sample_rate (sr)
 	, plugin_key (key)
@@ -56,6 +60,7 @@ AudioAnalyser::AudioAnalyser (float sr, AnalysisPluginKey key)
 
 AudioAnalyser::~AudioAnalyser ()
 {
+	Glib::Threads::Mutex::Lock lm (loader_lock);
 	delete plugin;
 }
 
@@ -64,9 +69,11 @@ AudioAnalyser::initialize_plugin (AnalysisPluginKey key, float sr)
 {
 	using namespace Vamp::HostExt;
 
-	PluginLoader* loader (PluginLoader::getInstance());
-
-	plugin = loader->loadPlugin (key, sr, PluginLoader::ADAPT_ALL_SAFE);
+	{
+		Glib::Threads::Mutex::Lock lm (loader_lock);
+		PluginLoader* loader (PluginLoader::getInstance());
+		plugin = loader->loadPlugin (key, sr, PluginLoader::ADAPT_ALL_SAFE);
+	}
 
 	if (!plugin) {
 		error << string_compose (_("VAMP Plugin \"%1\" could not be loaded"), key) << endmsg;
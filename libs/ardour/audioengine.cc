@@ -61,7 +61,9 @@
 #include "ardour/mtdm.h"
 #include "ardour/port.h"
 #include "ardour/process_thread.h"
+#include "ardour/processor.h"
 #include "ardour/rc_configuration.h"
+#include "ardour/route.h"
 #include "ardour/session.h"
 #include "ardour/transport_master_manager.h"
 
@@ -436,7 +438,8 @@ AudioEngine::process_callback (pframes_t nframes)
 			samplecnt_t sr = sample_rate ();
 			samplepos_t tp = _session->transport_sample ();
 			/* Note: this does not take Port latency into account:
-			 * - always add 12 samples (Port::_resampler_quality)
+			 * - add the resampler latency, Port::resampler_quality () - 1
+			 *   samples ("port-resampler-quality", default 12)
 			 * - ExistingMaterial: subtract playback latency from engine-pulse
 			 *   We assume the player listens and plays along. Recorded region is moved
 			 *   back by playback_latency
@@ -743,6 +746,52 @@ AudioEngine::remove_session ()
 	remove_all_ports ();
 }
 
+/** Clear the route statistics and enable timing, unless a session is
+ * being loaded or removed. Returns true if collecting started.
+ */
+bool
+AudioEngine::start_route_process_stats ()
+{
+	if (!_session || _session->loading () || _session->deletion_in_progress ()) {
+		return false;
+	}
+
+	boost::shared_ptr<RouteList> rl = _session->get_routes ();
+	for (RouteList::const_iterator i = rl->begin (); i != rl->end (); ++i) {
+		(*i)->clear_process_stats ();
+	}
+
+	Processor::set_timing_enabled (true);
+	return true;
+}
+
+void
+AudioEngine::stop_route_process_stats ()
+{
+	Processor::set_timing_enabled (Config->get_processor_timing ());
+}
+
+void
+AudioEngine::get_route_process_stats (std::vector<RouteProcessStats>& stats)
+{
+	/* keep the session alive */
+	Glib::Threads::Mutex::Lock lm (_process_lock);
+
+	stats.clear ();
+	if (!_session) {
+		return;
+	}
+
+	boost::shared_ptr<RouteList> rl = _session->get_routes ();
+	for (RouteList::const_iterator i = rl->begin (); i != rl->end (); ++i) {
+		uint64_t min, max;
+		double avg, dev;
+		if ((*i)->get_process_stats (min, max, avg, dev)) {
+			stats.push_back (RouteProcessStats ((*i)->name (), min, max, avg, dev));
+		}
+	}
+}
+
 void
 AudioEngine::died ()
 {
@@ -961,6 +1010,12 @@ AudioEngine::start (bool for_latency)
 	_processed_samples = 0;
 	last_monitor_check = 0;
 
+	if (Port::resampler_quality () != Config->get_port_resampler_quality ()) {
+		/* nothing is processing, the ports can set up their resamplers */
+		Port::set_resampler_quality (Config->get_port_resampler_quality ());
+		setup_port_resamplers ();
+	}
+
 	int error_code = _backend->start (for_latency);
 
 	if (error_code != 0) {
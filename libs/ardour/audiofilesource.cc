@@ -165,6 +165,7 @@ AudioFileSource::~AudioFileSource ()
 	if (removable()) {
 		::g_unlink (_path.c_str());
 		::g_unlink (_peakpath.c_str());
+		::g_unlink (stats_path ().c_str());
 	}
 }
 
@@ -253,6 +254,7 @@ AudioFileSource::mark_streaming_write_completed (const Lock& lock)
 int
 AudioFileSource::move_dependents_to_trash()
 {
+	::g_unlink (stats_path ().c_str());
 	return ::g_unlink (_peakpath.c_str());
 }
 
@@ -42,6 +42,7 @@
 
 #include "evoral/Curve.h"
 
+#include "ardour/audio_source_stats.h"
 #include "ardour/audioregion.h"
 #include "ardour/session.h"
 #include "ardour/dB.h"
@@ -1401,9 +1402,117 @@ AudioRegion::set_scale_amplitude (gain_t g)
 	send_change (PropertyChange (Properties::scale_amplitude));
 }
 
+/** Get up to date statistics of all sources that cover the region.
+ *  @param force compute missing statistics even if the region is only
+ *  a small part of its sources.
+ */
+bool
+AudioRegion::get_source_stats (StatsList& stats, bool force, Progress* p) const
+{
+	uint32_t const n_chan = n_channels ();
+
+	stats.clear ();
+
+	for (uint32_t c = 0; c < n_chan; ++c) {
+		boost::shared_ptr<AudioSource> src = audio_source (c);
+
+		/* computing statistics reads the whole source, which is
+		 * only worth it if the region covers a good part of it.
+		 */
+		bool const compute = force || _length * 2 >= src->readable_length ();
+
+		if (p) {
+			p->descend (1.f / n_chan);
+		}
+
+		boost::shared_ptr<AudioSourceStats const> s = src->stats (compute, p);
+
+		if (p) {
+			p->ascend ();
+		}
+
+		if (!s || s->length () < _start + _length || (!stats.empty () && s->block_size () != stats.front ()->block_size ())) {
+			stats.clear ();
+			return false;
+		}
+
+		stats.push_back (s);
+	}
+
+	return !stats.empty ();
+}
+
+/** Accumulate peak and sum of squares of channel @a chn of the region,
+ *  using the blocks of @a stats, only partial blocks at either end
+ *  of the region are read.
+ */
+bool
+AudioRegion::stats_peak_and_power (uint32_t chn, AudioSourceStats const& stats, double& peak, double& power) const
+{
+	samplecnt_t const bs = stats.block_size ();
+	samplepos_t const fend = _start + _length;
+
+	/* [first_block, last_block) are completely inside the region */
+	samplepos_t const first_block = (_start + bs - 1) / bs;
+	samplepos_t const last_block = max (first_block, fend / bs);
+
+	vector<AudioSourceStats::Block> const& blocks (stats.blocks ());
+
+	for (samplepos_t b = first_block; b < last_block; ++b) {
+		peak = max (peak, (double) blocks[b].peak);
+		power += blocks[b].power;
+	}
+
+	samplepos_t const head_end = min (first_block * bs, fend);
+	samplepos_t const tail_start = max (last_block * bs, head_end);
+
+	boost::scoped_array<Sample> buf (new Sample[bs]);
+
+	samplepos_t const edges[2][2] = { { _start, head_end }, { tail_start, fend } };
+
+	for (int e = 0; e < 2; ++e) {
+		samplecnt_t const to_read = edges[e][1] - edges[e][0];
+		if (to_read <= 0) {
+			continue;
+		}
+		if (read_raw_internal (buf.get(), edges[e][0], to_read, chn) != to_read) {
+			return false;
+		}
+		peak = compute_peak (buf.get(), to_read, peak);
+		for (samplecnt_t i = 0; i < to_read; ++i) {
+			power += buf[i] * buf[i];
+		}
+	}
+
+	return true;
+}
+
 double
 AudioRegion::maximum_amplitude (Progress* p) const
 {
+	StatsList stats;
+
+	if (get_source_stats (stats, false, p)) {
+		double maxamp = 0;
+		double power = 0;
+
+		for (uint32_t n = 0; n < stats.size (); ++n) {
+			if (!stats_peak_and_power (n, *stats[n], maxamp, power)) {
+				return 0;
+			}
+		}
+
+		if (p) {
+			p->set_progress (1);
+		}
+
+		return maxamp;
+	}
+
+	if (p && p->cancelled ()) {
+		return -1;
+	}
+
 	samplepos_t fpos = _start;
 	samplepos_t const fend = _start + _length;
 	double maxamp = 0;
@@ -1443,6 +1552,29 @@ AudioRegion::maximum_amplitude (Progress* p) const
 double
 AudioRegion::rms (Progress* p) const
 {
+	StatsList stats;
+
+	if (_length > 0 && get_source_stats (stats, false, p)) {
+		double maxamp = 0;
+		double power = 0;
+
+		for (uint32_t n = 0; n < stats.size (); ++n) {
+			if (!stats_peak_and_power (n, *stats[n], maxamp, power)) {
+				return 0;
+			}
+		}
+
+		if (p) {
+			p->set_progress (1);
+		}
+
+		return sqrt (2. * power / (double)(_length * stats.size ()));
+	}
+
+	if (p && p->cancelled ()) {
+		return -1;
+	}
+
 	samplepos_t fpos = _start;
 	samplepos_t const fend = _start + _length;
 	uint32_t const n_chan = n_channels ();
@@ -1479,6 +1611,34 @@ AudioRegion::rms (Progress* p) const
 	return sqrt (2. * rms / (double)(total * n_chan));
 }
 
+double
+AudioRegion::loudness (Progress* p) const
+{
+	StatsList stats;
+
+	if (!get_source_stats (stats, true, p)) {
+		if (p && p->cancelled ()) {
+			return -1000;
+		}
+		return -200;
+	}
+
+	samplecnt_t const bs = stats.front ()->block_size ();
+	samplepos_t const first_block = (_start + bs - 1) / bs;
+	samplepos_t const last_block = max (first_block, (_start + _length) / bs);
+
+	vector<AudioSourceStats const*> channels;
+	for (StatsList::const_iterator i = stats.begin (); i != stats.end (); ++i) {
+		channels.push_back (i->get ());
+	}
+
+	if (p) {
+		p->set_progress (1);
+	}
+
+	return AudioSourceStats::integrated_loudness (channels, first_block, last_block - first_block);
+}
+
 /** Normalize using a given maximum amplitude and target, so that region
  *  _scale_amplitude becomes target / max_amplitude.
  */
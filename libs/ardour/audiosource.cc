@@ -32,6 +32,7 @@
 #include <fcntl.h>
 #include <float.h>
 #include <cerrno>
+#include <cstring>
 #include <ctime>
 #include <cmath>
 #include <iomanip>
@@ -59,7 +60,9 @@
 #include "pbd/scoped_file_descriptor.h"
 #include "pbd/xml++.h"
 
+#include "ardour/audio_source_stats.h"
 #include "ardour/audiosource.h"
+#include "ardour/filename_extensions.h"
 #include "ardour/rc_configuration.h"
 #include "ardour/runtime_functions.h"
 #include "ardour/session.h"
@@ -233,11 +236,94 @@ AudioSource::rename_peakfile (string newpath)
 		}
 	}
 
+	string const old_stats = stats_path ();
+
 	_peakpath = newpath;
 
+	if (Glib::file_test (old_stats, Glib::FILE_TEST_EXISTS)) {
+		/* not fatal, statistics are re-computed when needed */
+		g_rename (old_stats.c_str(), stats_path ().c_str());
+	}
+
 	return 0;
 }
 
+string
+AudioSource::stats_path () const
+{
+	string path (_peakpath);
+	const size_t suffix_len = strlen (peakfile_suffix);
+
+	if (path.size () > suffix_len && path.compare (path.size () - suffix_len, suffix_len, peakfile_suffix) == 0) {
+		path.erase (path.size () - suffix_len);
+	}
+
+	return path + stats_file_suffix;
+}
+
+boost::shared_ptr<AudioSourceStats const>
+AudioSource::stats (bool compute, Progress* p) const
+{
+	Glib::Threads::Mutex::Lock lm (_stats_lock);
+
+	if (_stats && _stats->length () == _length && _stats->sample_rate () == sample_rate ()) {
+		return _stats;
+	}
+
+	_stats.reset ();
+
+	if (_peakpath.empty () || _length == 0) {
+		return _stats;
+	}
+
+	boost::shared_ptr<AudioSourceStats> s (new AudioSourceStats (_length, sample_rate ()));
+
+	if (s->load (stats_path ()) == 0) {
+		_stats = s;
+	} else if (compute && s->compute (*this, p) == 0) {
+		s->save (stats_path ());
+		_stats = s;
+	}
+
+	return _stats;
+}
+
+/** Feed the block statistics with the data that peaks are computed from,
+ * so that captured and imported sources have statistics without another
+ * pass over the data (and without depending on the Analyser).
+ */
+void
+AudioSource::add_to_stats (Sample const* buf, samplepos_t first_sample, samplecnt_t cnt)
+{
+	Glib::Threads::Mutex::Lock lm (_stats_builder_lock);
+
+	if (first_sample == 0) {
+		_stats_builder.reset (new AudioSourceStats (0, sample_rate ()));
+	} else if (!_stats_builder || _stats_builder->length () != first_sample) {
+		/* not written in order, compute them when needed */
+		_stats_builder.reset ();
+		return;
+	}
+
+	_stats_builder->add (buf, cnt);
+}
+
+void
+AudioSource::finish_stats (bool done)
+{
+	Glib::Threads::Mutex::Lock lm (_stats_builder_lock);
+
+	if (done && _stats_builder && _stats_builder->length () == _length && !_peakpath.empty ()) {
+		_stats_builder->finish ();
+		_stats_builder->save (stats_path ());
+
+		Glib::Threads::Mutex::Lock ls (_stats_lock);
+		_stats = _stats_builder;
+	}
+
+	_stats_builder.reset ();
+}
+
 int
 AudioSource::initialize_peakfile (const string& audio_path, const bool in_session)
 {
@@ -839,6 +925,8 @@ AudioSource::done_with_peakfile_writes (bool done)
 		compute_and_write_peaks (0, 0, 0, true, false, _FPP);
 	}
 
+	finish_stats (done);
+
 	if (done) {
 		Glib::Threads::Mutex::Lock lm (_peaks_ready_lock);
 		_peaks_built = true;
@@ -877,6 +965,10 @@ AudioSource::compute_and_write_peaks (Sample* buf, samplecnt_t first_sample, sam
 		}
 	}
 
+	if (buf && cnt > 0) {
+		add_to_stats (buf, first_sample, cnt);
+	}
+
   restart:
 	if (peak_leftover_cnt) {
 
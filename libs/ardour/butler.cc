@@ -28,6 +28,7 @@
 #include <poll.h>
 #endif
 
+#include "pbd/cycle_trace.h"
 #include "pbd/error.h"
 #include "pbd/pthread_utils.h"
 
@@ -250,7 +251,12 @@ Butler::thread_work ()
 				continue;
 			}
 			// DEBUG_TRACE (DEBUG::Butler, string_compose ("butler refills %1, playback load = %2\n", tr->name(), tr->playback_buffer_load()));
-			switch (tr->do_refill ()) {
+			int refill;
+			{
+				PBD::CycleTraceScope ts ("refill", tr->id ().get_id ());
+				refill = tr->do_refill ();
+			}
+			switch (refill) {
 			case 0:
 				//DEBUG_TRACE (DEBUG::Butler, string_compose ("\ttrack refill done %1\n", tr->name()));
 				break;
@@ -312,6 +318,10 @@ Butler::thread_work ()
 
 		DEBUG_TRACE (DEBUG::Butler, "butler emptying pool trash\n");
 		empty_pool_trash ();
+
+		if (PBD::CycleTrace::dump_requested ()) {
+			_session.write_cycle_trace ();
+		}
 	}
 
 	return (0);
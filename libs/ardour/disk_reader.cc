@@ -19,6 +19,7 @@
 
 #include <boost/smart_ptr/scoped_array.hpp>
 
+#include "pbd/cycle_trace.h"
 #include "pbd/enumwriter.h"
 #include "pbd/memento_command.h"
 #include "pbd/playback_buffer.h"
@@ -260,6 +261,8 @@ DiskReader::use_playlist (DataType dt, boost::shared_ptr<Playlist> playlist)
 void
 DiskReader::run (BufferSet& bufs, samplepos_t start_sample, samplepos_t end_sample, double speed, pframes_t nframes, bool result_required)
 {
+	PBD::CycleTraceScope ts ("disk reader", _id.get_id ());
+
 	uint32_t n;
 	boost::shared_ptr<ChannelList> c = channels.reader();
 	ChannelList::iterator chan;
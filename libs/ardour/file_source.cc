@@ -58,6 +58,14 @@ using namespace Glib;
 
 PBD::Signal2<int,std::string,std::vector<std::string> > FileSource::AmbiguousFileName;
 
+static Glib::Threads::Private<bool> no_questions_in_this_thread;
+
+void
+FileSource::disallow_questions_in_this_thread ()
+{
+	no_questions_in_this_thread.replace (new bool (true));
+}
+
 FileSource::FileSource (Session& session, DataType type, const string& path, const string& origin, Source::Flag flag)
 	: Source(session, type, path, flag)
 	, _path (path)
@@ -292,6 +300,10 @@ FileSource::find (Session& s, DataType type, const string& path, bool must_exist
 
 			/* more than one match: ask the user */
 
+			if (no_questions_in_this_thread.get ()) {
+				goto out;
+			}
+
                         int which = FileSource::AmbiguousFileName (path, de_duped_hits).value_or (-1);
 
                         if (which < 0) {
@@ -154,6 +154,7 @@ find_peaks_t            ARDOUR::find_peaks = 0;
 apply_gain_to_buffer_t  ARDOUR::apply_gain_to_buffer = 0;
 mix_buffers_with_gain_t ARDOUR::mix_buffers_with_gain = 0;
 mix_buffers_no_gain_t   ARDOUR::mix_buffers_no_gain = 0;
+mix_buffers_with_gain_vector_t ARDOUR::mix_buffers_with_gain_vector = 0;
 copy_vector_t           ARDOUR::copy_vector = 0;
 
 PBD::Signal1<void,std::string> ARDOUR::BootMessage;
@@ -207,6 +208,8 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_no_gain   = x86_sse_avx_mix_buffers_no_gain;
 			copy_vector           = x86_sse_avx_copy_vector;
 
+			mix_buffers_with_gain_vector = x86_sse_avx_mix_buffers_with_gain_vector;
+
 			generic_mix_functions = false;
 
 		} else if (fpu->has_sse()) {
@@ -221,6 +224,8 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_no_gain   = x86_sse_mix_buffers_no_gain;
 			copy_vector           = default_copy_vector;
 
+			mix_buffers_with_gain_vector = x86_sse_mix_buffers_with_gain_vector;
+
 			generic_mix_functions = false;
 
 		}
@@ -235,6 +240,8 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_no_gain    = veclib_mix_buffers_no_gain;
 			copy_vector            = default_copy_vector;
 
+			mix_buffers_with_gain_vector = veclib_mix_buffers_with_gain_vector;
+
 			generic_mix_functions = false;
 
 			info << "Apple VecLib H/W specific optimizations in use" << endmsg;
@@ -255,6 +262,8 @@ setup_hardware_optimization (bool try_optimization)
 		mix_buffers_no_gain   = default_mix_buffers_no_gain;
 		copy_vector           = default_copy_vector;
 
+		mix_buffers_with_gain_vector = default_mix_buffers_with_gain_vector;
+
 		info << "No H/W specific optimizations in use" << endmsg;
 	}
 
@@ -24,6 +24,7 @@
 #include <stdio.h>
 
 #include "pbd/compose.h"
+#include "pbd/cycle_trace.h"
 #include "pbd/debug_rt_alloc.h"
 #include "pbd/pthread_utils.h"
 
@@ -439,7 +440,10 @@ Graph::run_one ()
 
 	/* Process the graph-node */
 	g_atomic_int_dec_and_test (&_trigger_queue_size);
-	to_run->run (_current_chain);
+	{
+		PBD::CycleTraceScope ts ("graph node");
+		to_run->run (_current_chain);
+	}
 
 	DEBUG_TRACE (DEBUG::ProcessThreads, string_compose ("%1 has finished run_one()\n", pthread_name ()));
 }
@@ -20,12 +20,14 @@
 
 #include "ardour/graph.h"
 #include "ardour/graphnode.h"
+#include "ardour/processor.h"
 #include "ardour/route.h"
 
 using namespace ARDOUR;
 
 GraphNode::GraphNode (boost::shared_ptr<Graph> graph)
 	: _graph (graph)
+	, _stat_reset (0)
 {
 }
 
@@ -77,5 +79,30 @@ GraphNode::finish (int chain)
 void
 GraphNode::process ()
 {
+	if (g_atomic_int_compare_and_exchange (&_stat_reset, 1, 0)) {
+		_timing_stats.reset ();
+	}
+
+	if (!Processor::timing_enabled ()) {
+		_graph->process_one_route (dynamic_cast<Route*> (this));
+		return;
+	}
+
+	_timing_stats.start ();
 	_graph->process_one_route (dynamic_cast<Route*> (this));
+	_timing_stats.update ();
+}
+
+bool
+GraphNode::get_process_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const
+{
+	/* may race with TimingStats::update in a process thread,
+	 * good enough for statistics, see also Processor::get_stats */
+	return _timing_stats.get_stats (min, max, avg, dev);
+}
+
+void
+GraphNode::clear_process_stats ()
+{
+	g_atomic_int_set (&_stat_reset, 1);
 }
@@ -39,6 +39,7 @@
 
 #include "pbd/gstdio_compat.h"
 #include <glibmm.h>
+#include <glibmm/threads.h>
 
 #include <boost/scoped_array.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -46,6 +47,8 @@
 
 #include "pbd/basename.h"
 #include "pbd/convert.h"
+#include "pbd/cpus.h"
+#include "pbd/pthread_utils.h"
 
 #include "evoral/SMF.h"
 
@@ -246,7 +249,7 @@ compose_status_message (const string& path,
 
 static void
 write_audio_data_to_new_files (ImportableSource* source, ImportStatus& status,
-                               vector<boost::shared_ptr<Source> >& newfiles)
+                               vector<boost::shared_ptr<Source> >& newfiles, volatile float& progress)
 {
 	const samplecnt_t nframes = ResampledImportableSource::blocksize;
 	boost::shared_ptr<AudioFileSource> afs;
@@ -267,7 +270,7 @@ write_audio_data_to_new_files (ImportableSource* source, ImportStatus& status,
 	boost::shared_ptr<AudioSource> s = boost::dynamic_pointer_cast<AudioSource> (newfiles[0]);
 	assert (s);
 
-	status.progress = 0.0f;
+	progress = 0.0f;
 	float progress_multiplier = 1;
 	float progress_base = 0;
 	const float progress_length = source->ratio() * source->length();
@@ -291,7 +294,7 @@ write_audio_data_to_new_files (ImportableSource* source, ImportStatus& status,
 			peak = compute_peak (data.get(), nread, peak);
 
 			read_count += nread / channels;
-			status.progress = 0.5 * read_count / progress_length;
+			progress = 0.5 * read_count / progress_length;
 		}
 
 		if (peak >= 1) {
@@ -350,19 +353,19 @@ write_audio_data_to_new_files (ImportableSource* source, ImportStatus& status,
 		}
 
 		read_count += nfread;
-		status.progress = progress_base + progress_multiplier * read_count / progress_length;
+		progress = progress_base + progress_multiplier * read_count / progress_length;
 	}
 }
 
 static void
 write_midi_data_to_new_files (Evoral::SMF* source, ImportStatus& status,
                               vector<boost::shared_ptr<Source> >& newfiles,
-                              bool split_type0)
+                              bool split_type0, volatile float& progress)
 {
 	uint32_t buf_size = 4;
 	uint8_t* buf      = (uint8_t*) malloc (buf_size);
 
-	status.progress = 0.0f;
+	progress = 0.0f;
 	uint16_t num_tracks;
 	bool type0 = source->is_type0 () && split_type0;
 	const std::set<uint8_t>& chn = source->channels ();
@@ -441,8 +444,8 @@ write_midi_data_to_new_files (Evoral::SMF* source, ImportStatus& status,
 						size,
 						buf));
 
-				if (status.progress < 0.99) {
-					status.progress += 0.01;
+				if (progress < 0.99) {
+					progress += 0.01;
 				}
 			}
 
@@ -490,114 +493,253 @@ remove_file_source (boost::shared_ptr<Source> source)
 	}
 }
 
-// This function is still unable to cleanly update an existing source, even though
-// it is possible to set the ImportStatus flag accordingly. The functinality
-// is disabled at the GUI until the Source implementations are able to provide
-// the necessary API.
-void
-Session::import_files (ImportStatus& status)
+namespace {
+
+typedef vector<boost::shared_ptr<Source> > Sources;
+
+/** state shared by the threads of one Session::import_files() call */
+struct ImportJob {
+	ImportJob (Session& s, ImportStatus& st)
+		: session (s)
+		, status (st)
+		, new_sources (st.paths.size ())
+		, progress (st.paths.size (), 0.f)
+		, messages (st.paths.size ())
+		, next (0)
+		, n_done (0)
+		, n_running (0)
+		, last_started (0)
+	{}
+
+	Session&             session;
+	ImportStatus&        status;
+	std::vector<Sources> new_sources; ///< per path, in the order of status.paths
+	std::vector<float>   progress;    ///< per path, 0 .. 1
+	std::vector<string>  messages;    ///< per path, protected by lock
+	Glib::Threads::Mutex lock;        ///< also serializes creating new sources
+	gint next;
+	gint n_done;
+	gint n_running;
+	gint last_started;
+};
+
+}
+
+static void
+import_one_file (ImportJob& job, uint32_t n)
 {
-	typedef vector<boost::shared_ptr<Source> > Sources;
-	Sources all_new_sources;
-	boost::shared_ptr<AudioFileSource> afs;
-	boost::shared_ptr<SMFSource> smfs;
+	ImportStatus& status (job.status);
+	Session& session (job.session);
+	string const& path (status.paths[n]);
+
+	boost::shared_ptr<ImportableSource> source;
+	boost::scoped_ptr<Evoral::SMF> smf_reader;
 	uint32_t channels = 0;
 	vector<string> smf_names;
 
-	status.sources.clear ();
+	const DataType type = SMFSource::safe_midi_file_extension (path) ? DataType::MIDI : DataType::AUDIO;
 
-	for (vector<string>::const_iterator p = status.paths.begin();
-	     p != status.paths.end() && !status.cancel;
-	     ++p)
-	{
-		boost::shared_ptr<ImportableSource> source;
-
-		const DataType type = SMFSource::safe_midi_file_extension (*p) ? DataType::MIDI : DataType::AUDIO;
-		boost::scoped_ptr<Evoral::SMF> smf_reader;
-
-		if (type == DataType::AUDIO) {
-			try {
-				source = open_importable_source (*p, sample_rate(), status.quality);
-				channels = source->channels();
-			} catch (const failed_constructor& err) {
-				error << string_compose(_("Import: cannot open input sound file \"%1\""), (*p)) << endmsg;
-				status.done = status.cancel = true;
-				return;
-			}
+	if (type == DataType::AUDIO) {
+		try {
+			source = open_importable_source (path, session.sample_rate(), status.quality);
+			channels = source->channels();
+		} catch (const failed_constructor& err) {
+			error << string_compose(_("Import: cannot open input sound file \"%1\""), path) << endmsg;
+			status.cancel = true;
+			return;
+		}
 
-		} else {
-			try {
-				smf_reader.reset (new Evoral::SMF());
+	} else {
+		try {
+			smf_reader.reset (new Evoral::SMF());
 
-				if (smf_reader->open(*p)) {
-					throw Evoral::SMF::FileError (*p);
-				}
+			if (smf_reader->open(path)) {
+				throw Evoral::SMF::FileError (path);
+			}
 
-				if (smf_reader->is_type0 () && status.split_midi_channels) {
-					channels = smf_reader->channels().size();
-				} else {
-					channels = smf_reader->num_tracks();
-					switch (status.midi_track_name_source) {
-					case SMFTrackNumber:
-						break;
-					case SMFTrackName:
-						smf_reader->track_names (smf_names);
-						break;
-					case SMFInstrumentName:
-						smf_reader->instrument_names (smf_names);
-						break;
-					}
+			if (smf_reader->is_type0 () && status.split_midi_channels) {
+				channels = smf_reader->channels().size();
+			} else {
+				channels = smf_reader->num_tracks();
+				switch (status.midi_track_name_source) {
+				case SMFTrackNumber:
+					break;
+				case SMFTrackName:
+					smf_reader->track_names (smf_names);
+					break;
+				case SMFInstrumentName:
+					smf_reader->instrument_names (smf_names);
+					break;
 				}
-			} catch (...) {
-				error << _("Import: error opening MIDI file") << endmsg;
-				status.done = status.cancel = true;
-				return;
 			}
+		} catch (...) {
+			error << _("Import: error opening MIDI file") << endmsg;
+			status.cancel = true;
+			return;
 		}
+	}
 
-		if (channels == 0) {
-			error << _("Import: file contains no channels.") << endmsg;
-			continue;
-		}
+	if (channels == 0) {
+		error << _("Import: file contains no channels.") << endmsg;
+		return;
+	}
 
-		vector<string> new_paths = get_paths_for_new_sources (status.replace_existing_source, *p, channels, smf_names);
-		Sources newfiles;
-		samplepos_t natural_position = source ? source->natural_position() : 0;
+	Sources& newfiles (job.new_sources[n]);
+	samplepos_t natural_position = source ? source->natural_position() : 0;
 
+	{
+		/* finding unused names and creating the files must not
+		 * interleave with other threads doing the same.
+		 */
+		Glib::Threads::Mutex::Lock lm (job.lock);
+
+		if (status.cancel) {
+			return;
+		}
+
+		vector<string> new_paths = session.get_paths_for_new_sources (status.replace_existing_source, path, channels, smf_names);
 
 		if (status.replace_existing_source) {
 			fatal << "THIS IS NOT IMPLEMENTED YET, IT SHOULD NEVER GET CALLED!!! DYING!" << endmsg;
-			status.cancel = !map_existing_mono_sources (new_paths, *this, sample_rate(), newfiles, this);
+			if (!map_existing_mono_sources (new_paths, session, session.sample_rate(), newfiles, &session)) {
+				status.cancel = true;
+			}
+		} else if (!create_mono_sources_for_writing (new_paths, session, session.sample_rate(), newfiles, natural_position)) {
+			/* only ever set the flag, it may have been set by the
+			 * user or by another file failing meanwhile */
+			status.cancel = true;
+		}
+
+		if (source) {
+			job.messages[n] = compose_status_message (path, source->samplerate(), session.sample_rate(), n + 1, status.total);
 		} else {
-			status.cancel = !create_mono_sources_for_writing (new_paths, *this, sample_rate(), newfiles, natural_position);
+			job.messages[n] = string_compose(_("Loading MIDI file %1"), path);
 		}
+	}
 
-		// copy on cancel/failure so that any files that were created will be removed below
-		std::copy (newfiles.begin(), newfiles.end(), std::back_inserter(all_new_sources));
+	if (status.cancel) {
+		/* any files that were created are removed by the caller */
+		return;
+	}
 
-		if (status.cancel) {
+	g_atomic_int_set (&job.last_started, n);
+
+	boost::shared_ptr<AudioFileSource> afs;
+
+	for (Sources::iterator i = newfiles.begin(); i != newfiles.end(); ++i) {
+		if ((afs = boost::dynamic_pointer_cast<AudioFileSource>(*i)) != 0) {
+			afs->prepare_for_peakfile_writes ();
+		}
+	}
+
+	volatile float& progress (job.progress[n]);
+
+	if (source) { // audio
+		write_audio_data_to_new_files (source.get(), status, newfiles, progress);
+	} else if (smf_reader) { // midi
+		write_midi_data_to_new_files (smf_reader.get(), status, newfiles, status.split_midi_channels, progress);
+	}
+}
+
+static void
+import_thread_work (ImportJob* job)
+{
+	pthread_set_name ("ImportWorker");
+
+	while (!job->status.cancel) {
+		const gint n = g_atomic_int_add (&job->next, 1);
+		if (n >= (gint) job->status.paths.size ()) {
+			break;
+		}
+
+		import_one_file (*job, n);
+
+		job->progress[n] = 1.f;
+		g_atomic_int_inc (&job->n_done);
+	}
+
+	g_atomic_int_add (&job->n_running, -1);
+}
+
+// This function is still unable to cleanly update an existing source, even though
+// it is possible to set the ImportStatus flag accordingly. The functinality
+// is disabled at the GUI until the Source implementations are able to provide
+// the necessary API.
+void
+Session::import_files (ImportStatus& status)
+{
+	Sources all_new_sources;
+	boost::shared_ptr<AudioFileSource> afs;
+	boost::shared_ptr<SMFSource> smfs;
+
+	status.sources.clear ();
+
+	/* Files are imported concurrently by a bounded pool of threads.
+	 * Every thread decodes, resamples and writes (which includes
+	 * building peaks) one file at a time, so that the stages of
+	 * different files overlap.
+	 */
+
+	ImportJob job (*this, status);
+
+	const uint32_t n_threads = std::max ((uint32_t) 1, std::min ((uint32_t) std::min (status.paths.size (), (size_t) 16), hardware_concurrency ()));
+	std::vector<Glib::Threads::Thread*> threads;
+
+	g_atomic_int_set (&job.n_running, n_threads);
+
+	for (uint32_t n = 0; n < n_threads; ++n) {
+		try {
+			threads.push_back (Glib::Threads::Thread::create (sigc::bind (sigc::ptr_fun (import_thread_work), &job)));
+		} catch (...) {
+			g_atomic_int_add (&job.n_running, threads.size () - n_threads);
 			break;
 		}
+	}
+
+	if (threads.empty ()) {
+		g_atomic_int_set (&job.n_running, 1);
+		import_thread_work (&job);
+	}
 
-		for (Sources::iterator i = newfiles.begin(); i != newfiles.end(); ++i) {
-			if ((afs = boost::dynamic_pointer_cast<AudioFileSource>(*i)) != 0) {
-				afs->prepare_for_peakfile_writes ();
+	/* report progress the same way a sequential import does:
+	 * "current" counts finished files, "progress" those in flight.
+	 */
+	while (g_atomic_int_get (&job.n_running) > 0) {
+		const gint n_done = g_atomic_int_get (&job.n_done);
+		float in_flight = 0;
+
+		for (size_t n = 0; n < job.progress.size (); ++n) {
+			if (job.progress[n] < 1.f) {
+				in_flight += job.progress[n];
 			}
 		}
 
-		if (source) { // audio
-			status.doing_what = compose_status_message (*p, source->samplerate(),
-			                                            sample_rate(), status.current, status.total);
-			write_audio_data_to_new_files (source.get(), status, newfiles);
-		} else if (smf_reader) { // midi
-			status.doing_what = string_compose(_("Loading MIDI file %1"), *p);
-			write_midi_data_to_new_files (smf_reader.get(), status, newfiles, status.split_midi_channels);
+		{
+			Glib::Threads::Mutex::Lock lm (job.lock);
+			const guint n = g_atomic_int_get (&job.last_started);
+			if (n < job.messages.size () && !job.messages[n].empty ()) {
+				status.doing_what = job.messages[n];
+			}
 		}
 
-		++status.current;
-		status.progress = 0;
+		status.current = std::min ((uint32_t) n_done + 1, status.total);
+		status.progress = in_flight;
+
+		Glib::usleep (100000);
+	}
+
+	for (std::vector<Glib::Threads::Thread*>::iterator t = threads.begin (); t != threads.end (); ++t) {
+		(*t)->join ();
 	}
 
+	/* copy in order, also on cancel/failure so that any files that were created will be removed below */
+	for (std::vector<Sources>::const_iterator i = job.new_sources.begin (); i != job.new_sources.end (); ++i) {
+		std::copy (i->begin(), i->end(), std::back_inserter(all_new_sources));
+	}
+
+	status.current = status.total;
+	status.progress = 0;
+
 	if (!status.cancel) {
 		struct tm* now;
 		time_t xnow;
@@ -1083,6 +1083,8 @@ LuaBindings::common (lua_State* L)
 		.addFunction ("set_active", &Route::set_active)
 		.addFunction ("nth_plugin", &Route::nth_plugin)
 		.addFunction ("nth_processor", &Route::nth_processor)
+		.addRefFunction ("get_processor_stats", &Route::get_processor_stats)
+		.addFunction ("clear_processor_stats", &Route::clear_processor_stats)
 		.addFunction ("nth_send", &Route::nth_send)
 		.addFunction ("add_processor_by_index", &Route::add_processor_by_index)
 		.addFunction ("remove_processor", &Route::remove_processor)
@@ -1291,6 +1293,7 @@ LuaBindings::common (lua_State* L)
 		.addFunction ("scale_amplitude", &AudioRegion::scale_amplitude)
 		.addFunction ("maximum_amplitude", &AudioRegion::maximum_amplitude)
 		.addFunction ("rms", &AudioRegion::rms)
+		.addFunction ("loudness", &AudioRegion::loudness)
 		.addFunction ("fade_in_active", &AudioRegion::fade_in_active)
 		.addFunction ("fade_out_active", &AudioRegion::fade_out_active)
 		.addFunction ("set_fade_in_active", &AudioRegion::set_fade_in_active)
@@ -1436,6 +1439,9 @@ LuaBindings::common (lua_State* L)
 		.addFunction ("output_streams", &Processor::output_streams)
 		.addFunction ("input_streams", &Processor::input_streams)
 		.addFunction ("signal_latency", &Processor::signal_latency)
+		.addFunction ("provides_stats", &Processor::provides_stats)
+		.addFunction ("clear_stats", &Processor::clear_stats)
+		.addRefFunction ("get_stats", &Processor::get_stats)
 		.endClass ()
 
 		.deriveWSPtrClass <DiskIOProcessor, Processor> ("DiskIOProcessor")
@@ -1532,8 +1538,6 @@ LuaBindings::common (lua_State* L)
 		.addFunction ("signal_latency", &PluginInsert::signal_latency)
 		.addFunction ("get_count", &PluginInsert::get_count)
 		.addFunction ("is_channelstrip", &PluginInsert::is_channelstrip)
-		.addFunction ("clear_stats", &PluginInsert::clear_stats)
-		.addRefFunction ("get_stats", &PluginInsert::get_stats)
 		.endClass ()
 
 		.deriveWSPtrClass <ReadOnlyControl, PBD::StatefulDestructible> ("ReadOnlyControl")
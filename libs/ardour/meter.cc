@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 #include "pbd/compose.h"
@@ -39,8 +40,34 @@ using namespace std;
 
 using namespace ARDOUR;
 
+PeakMeter::ChannelLevels::ChannelLevels ()
+	: peak (0)
+	, max_peak (0)
+	, rms (0)
+	, true_peak (0)
+	, kmeter (0)
+	, iec1 (0)
+	, iec2 (0)
+	, vu (0)
+{
+}
+
+PeakMeter::BlockLevels::BlockLevels ()
+	: peak (0)
+	, power (0)
+	, true_peak (0)
+	, kmeter (0)
+	, iec1 (0)
+	, iec2 (0)
+	, vu (0)
+{
+	history[0] = history[1] = history[2] = 0;
+}
+
 PeakMeter::PeakMeter (Session& s, const std::string& name)
     : Processor (s, string_compose ("meter-%1", name))
+	, _block_combined_peak (0)
+	, _block_samples (0)
 {
 	Kmeterdsp::init(s.nominal_sample_rate());
 	Iec1ppmdsp::init(s.nominal_sample_rate());
@@ -50,8 +77,6 @@ PeakMeter::PeakMeter (Session& s, const std::string& name)
 	_meter_type = MeterPeak;
 	_reset_dpm = true;
 	_reset_max = true;
-	_bufcnt = 0;
-	_combined_peak = 0;
 }
 
 PeakMeter::~PeakMeter ()
@@ -66,11 +91,6 @@ PeakMeter::~PeakMeter ()
 		_iec2meter.pop_back();
 		_vumeter.pop_back();
 	}
-	while (_peak_power.size() > 0) {
-		_peak_buffer.pop_back();
-		_peak_power.pop_back();
-		_max_peak_signal.pop_back();
-	}
 }
 
 
@@ -93,7 +113,10 @@ PeakMeter::run (BufferSet& bufs, samplepos_t /*start_sample*/, samplepos_t /*end
 
 	_reset_max = false;
 	_reset_dpm = false;
-	_combined_peak = 0;
+
+	if (do_reset_dpm) {
+		_levels.combined_peak = 0;
+	}
 
 	// cerr << "meter " << name() << " runs with " << bufs.available() << " inputs\n";
 
@@ -103,14 +126,13 @@ PeakMeter::run (BufferSet& bufs, samplepos_t /*start_sample*/, samplepos_t /*end
 	uint32_t n = 0;
 
 	const float falloff_dB = Config->get_meter_falloff() * nframes / _session.nominal_sample_rate();
-	const uint32_t zoh = _session.nominal_sample_rate() * .021;
-	_bufcnt += nframes;
 
 	// Meter MIDI in to the first n_midi peaks
 	for (uint32_t i = 0; i < n_midi; ++i, ++n) {
+		ChannelLevels& l (_levels.chn[n]);
 		float val = 0.0f;
 		if (do_reset_dpm) {
-			_peak_power[n] = 0;
+			l.peak = 0;
 		}
 		const MidiBuffer& buf (bufs.get_midi(i));
 
@@ -122,8 +144,8 @@ PeakMeter::run (BufferSet& bufs, samplepos_t /*start_sample*/, samplepos_t /*end
 					val = this_vel;
 				}
 				if (val > 0.01) {
-					if (_combined_peak < 0.01) {
-						_combined_peak = 0.01;
+					if (_block_combined_peak < 0.01) {
+						_block_combined_peak = 0.01;
 					}
 				}
 			} else {
@@ -133,89 +155,181 @@ PeakMeter::run (BufferSet& bufs, samplepos_t /*start_sample*/, samplepos_t /*end
 				}
 			}
 		}
-		if (_peak_power[n] < (1.0 / 512.0)) {
-			_peak_power[n] = 0;
+		if (l.peak < (1.0 / 512.0)) {
+			l.peak = 0;
 		} else {
 			/* empirical algorithm WRT to audio falloff times */
-			_peak_power[n] -= sqrtf (_peak_power[n]) * falloff_dB * 0.045f;
+			l.peak -= sqrtf (l.peak) * falloff_dB * 0.045f;
 		}
-		_peak_power[n] = max(_peak_power[n], val);
-		_max_peak_signal[n] = 0;
+		l.peak = max(l.peak, val);
+		l.max_peak = 0;
 	}
 
 	// Meter audio in to the rest of the peaks
 	for (uint32_t i = 0; i < n_audio; ++i, ++n) {
-		if (bufs.get_audio(i).silent()) {
-			_peak_buffer[n] = 0;
-		} else {
-			_peak_buffer[n] = compute_peak (bufs.get_audio(i).data(), nframes, _peak_buffer[n]);
-			_peak_buffer[n] = std::min (_peak_buffer[n], 100.f); // cut off at +40dBFS for falloff.
-			_max_peak_signal[n] = std::max(_peak_buffer[n], _max_peak_signal[n]); // todo sync reset
-			_combined_peak = std::max(_peak_buffer[n], _combined_peak);
-		}
+		ChannelLevels& l (_levels.chn[n]);
+		BlockLevels& b (_block[n]);
 
+		if (do_reset_dpm) {
+			l.peak = l.rms = l.true_peak = l.kmeter = l.iec1 = l.iec2 = l.vu = 0;
+			b = BlockLevels ();
+		}
 		if (do_reset_max) {
-			_max_peak_signal[n] = 0;
+			l.max_peak = 0;
 		}
 
-		if (do_reset_dpm) {
-			_peak_buffer[n] = 0;
-			_peak_power[n] = -std::numeric_limits<float>::infinity();
+		if (!bufs.get_audio(i).silent()) {
+			measure_block (n, bufs.get_audio(i).data(), nframes);
 		} else {
-			// falloff
-			if (_peak_power[n] >  -318.8f) {
-				_peak_power[n] -= falloff_dB;
-			} else {
-				_peak_power[n] = -std::numeric_limits<float>::infinity();
-			}
-			_peak_power[n] = max(_peak_power[n], accurate_coefficient_to_dB(_peak_buffer[n]));
-			// integration buffer, retain peaks > 49Hz
-			if (_bufcnt > zoh) {
-				_peak_buffer[n] = 0;
-			}
+			b.history[0] = b.history[1] = b.history[2] = 0;
 		}
 
 		if (_meter_type & (MeterKrms | MeterK20 | MeterK14 | MeterK12)) {
 			_kmeter[i]->process(bufs.get_audio(i).data(), nframes);
+			b.kmeter = std::max (b.kmeter, _kmeter[i]->read());
 		}
 		if (_meter_type & (MeterIEC1DIN | MeterIEC1NOR)) {
 			_iec1meter[i]->process(bufs.get_audio(i).data(), nframes);
+			b.iec1 = std::max (b.iec1, _iec1meter[i]->read());
 		}
 		if (_meter_type & (MeterIEC2BBC | MeterIEC2EBU)) {
 			_iec2meter[i]->process(bufs.get_audio(i).data(), nframes);
+			b.iec2 = std::max (b.iec2, _iec2meter[i]->read());
 		}
 		if (_meter_type & MeterVU) {
 			_vumeter[i]->process(bufs.get_audio(i).data(), nframes);
+			b.vu = std::max (b.vu, _vumeter[i]->read());
 		}
 	}
 
 	// Zero any excess peaks
-	for (uint32_t i = n; i < _peak_power.size(); ++i) {
-		_peak_power[i] = -std::numeric_limits<float>::infinity();
-		_max_peak_signal[n] = 0;
+	for (uint32_t i = n; i < _levels.chn.size(); ++i) {
+		_levels.chn[i] = ChannelLevels ();
+		_block[i] = BlockLevels ();
 	}
 
-	if (_bufcnt > zoh) {
-		_bufcnt = 0;
+	_block_samples += nframes;
+
+	/* summarize and publish blocks of about 10ms (or one cycle, if
+	 * that is longer). MIDI levels and the max-peak are published
+	 * with every block, too.
+	 */
+	if (_block_samples >= _session.nominal_sample_rate() / 100) {
+		complete_block ();
+		publish_levels ();
 	}
 
 	_active = _pending_active;
 }
 
+/** accumulate peak, power and the true-peak estimate of @a data
+ * into the block of channel @a chn.
+ */
+void
+PeakMeter::measure_block (uint32_t chn, Sample const* data, pframes_t nframes)
+{
+	BlockLevels& b (_block[chn]);
+	ChannelLevels& l (_levels.chn[chn]);
+
+	float peak = compute_peak (data, nframes, 0);
+	peak = std::min (peak, 100.f); // cut off at +40dBFS for falloff.
+
+	b.peak = std::max (b.peak, peak);
+	l.max_peak = std::max (l.max_peak, peak);
+	_block_combined_peak = std::max (_block_combined_peak, peak);
+
+	/* Inter-sample peaks are estimated by interpolating halfway between
+	 * samples with a 4 tap filter. This is a cheap candidate, not an
+	 * ITU-R BS.1770 true-peak measurement (which oversamples by 4).
+	 * Plain loops, so that the compiler can vectorize them.
+	 */
+	float x[6];
+	const pframes_t nh = std::min (nframes, (pframes_t) 3);
+	x[0] = b.history[0];
+	x[1] = b.history[1];
+	x[2] = b.history[2];
+	for (pframes_t i = 0; i < nh; ++i) {
+		x[3 + i] = data[i];
+	}
+
+	float tp = 0;
+	for (pframes_t i = 0; i < nh; ++i) {
+		const float m = (9.f * (x[i + 1] + x[i + 2]) - (x[i] + x[i + 3])) * 0.0625f;
+		tp = std::max (tp, fabsf (m));
+	}
+	for (pframes_t i = 3; i < nframes; ++i) {
+		const float m = (9.f * (data[i - 2] + data[i - 1]) - (data[i - 3] + data[i])) * 0.0625f;
+		tp = std::max (tp, fabsf (m));
+	}
+
+	float power = 0;
+	for (pframes_t i = 0; i < nframes; ++i) {
+		power += data[i] * data[i];
+	}
+
+	b.true_peak = std::max (b.true_peak, std::max (tp, peak));
+	b.power += power;
+
+	for (pframes_t i = 0; i < 3; ++i) {
+		b.history[i] = x[nh + i];
+	}
+}
+
+/** turn the measured block into published levels, and start a new block */
+void
+PeakMeter::complete_block ()
+{
+	/* digital peak meter falloff, applied once per block (not per
+	 * sample or cycle), as a factor on the linear level.
+	 */
+	const float block_seconds = _block_samples / (float) _session.nominal_sample_rate();
+	const float falloff = dB_to_coefficient (-Config->get_meter_falloff() * block_seconds);
+	const uint32_t n_midi = current_meters.n_midi();
+
+	for (uint32_t n = n_midi; n < _block.size() && n < _levels.chn.size(); ++n) {
+		BlockLevels& b (_block[n]);
+		ChannelLevels& l (_levels.chn[n]);
+
+		l.peak      = std::max (b.peak, l.peak * falloff);
+		l.rms       = sqrtf (b.power / _block_samples);
+		l.true_peak = b.true_peak;
+		l.kmeter    = b.kmeter;
+		l.iec1      = b.iec1;
+		l.iec2      = b.iec2;
+		l.vu        = b.vu;
+
+		b.peak = b.power = b.true_peak = b.kmeter = b.iec1 = b.iec2 = b.vu = 0;
+	}
+
+	_levels.combined_peak = std::max (_block_combined_peak, _levels.combined_peak * falloff);
+	_block_combined_peak = 0;
+	_block_samples = 0;
+}
+
+void
+PeakMeter::publish_levels ()
+{
+	Levels& w (_published.write_buffer ());
+
+	/* sizes only change in resize_levels (), copy without allocating */
+	assert (w.chn.size () == _levels.chn.size ());
+	std::copy (_levels.chn.begin (), _levels.chn.end (), w.chn.begin ());
+	w.combined_peak = _levels.combined_peak;
+
+	_published.publish ();
+}
+
 void
 PeakMeter::reset ()
 {
 	if (_active || _pending_active) {
 		_reset_dpm = true;
 	} else {
-		for (size_t i = 0; i < _peak_power.size(); ++i) {
-			_peak_power[i] = -std::numeric_limits<float>::infinity();
-			_peak_buffer[i] = 0;
-		}
-		const uint32_t n_midi = min (current_meters.n_midi(), (uint32_t)_peak_power.size());
-		for (size_t i = 0; i < n_midi; ++i) {
-			_peak_power[i] = 0;
+		for (size_t i = 0; i < _levels.chn.size(); ++i) {
+			_levels.chn[i].peak = 0;
 		}
+		_levels.combined_peak = 0;
+		publish_levels ();
 	}
 
 	// these are handled async just fine.
@@ -234,10 +348,12 @@ PeakMeter::reset_max ()
 		_reset_max = true;
 		return;
 	}
-	for (size_t i = 0; i < _max_peak_signal.size(); ++i) {
-		_max_peak_signal[i] = 0;
-		_peak_buffer[i] = 0;
+	for (size_t i = 0; i < _levels.chn.size(); ++i) {
+		_levels.chn[i].max_peak = 0;
+		_levels.chn[i].peak = 0;
 	}
+	_levels.combined_peak = 0;
+	publish_levels ();
 }
 
 bool
@@ -284,31 +400,27 @@ PeakMeter::emit_configuration_changed () {
 	ConfigurationChanged (current_meters, current_meters); /* EMIT SIGNAL */
 }
 
+void
+PeakMeter::resize_levels (size_t n)
+{
+	/* not realtime safe, the caller must make sure that run () is
+	 * not called concurrently. Readers hold a reference into the
+	 * published buffers while they convert levels, so lock them out.
+	 */
+	_levels.chn.resize (n);
+	_block.resize (n);
+
+	Glib::Threads::Mutex::Lock lm (_reader_lock);
+	_published.for_each (ResizeLevels (n));
+}
+
 void
 PeakMeter::set_max_channels (const ChanCount& chn)
 {
 	uint32_t const limit = chn.n_total();
 	const size_t n_audio = chn.n_audio();
 
-	while (_peak_power.size() > limit) {
-		_peak_buffer.pop_back();
-		_peak_power.pop_back();
-		_max_peak_signal.pop_back();
-	}
-
-	while (_peak_power.size() < limit) {
-		_peak_buffer.push_back(0);
-		if (_peak_power.size() < current_meters.n_midi()) {
-			_peak_power.push_back(0);
-		} else {
-			_peak_power.push_back(-std::numeric_limits<float>::infinity());
-		}
-		_max_peak_signal.push_back(0);
-	}
-
-	assert(_peak_buffer.size() == limit);
-	assert(_peak_power.size() == limit);
-	assert(_max_peak_signal.size() == limit);
+	resize_levels (limit);
 
 	/* alloc/free other audio-only meter types. */
 	while (_kmeter.size() > n_audio) {
@@ -345,67 +457,167 @@ PeakMeter::set_max_channels (const ChanCount& chn)
 
 float
 PeakMeter::meter_level(uint32_t n, MeterType type) {
-	float mcptmp;
+	Glib::Threads::Mutex::Lock lm (_reader_lock);
+
+	Levels const& levels (_published.fetch ());
+
+	const uint32_t n_midi = current_meters.n_midi();
+
 	switch (type) {
 		case MeterKrms:
 		case MeterK20:
 		case MeterK14:
 		case MeterK12:
-			{
-				const uint32_t n_midi = current_meters.n_midi();
-				if (CHECKSIZE(_kmeter)) {
-					return accurate_coefficient_to_dB (_kmeter[n - n_midi]->read());
-				}
+			if (CHECKSIZE(_kmeter) && n < levels.chn.size()) {
+				return accurate_coefficient_to_dB (levels.chn[n].kmeter);
 			}
 			break;
 		case MeterIEC1DIN:
 		case MeterIEC1NOR:
-			{
-				const uint32_t n_midi = current_meters.n_midi();
-				if (CHECKSIZE(_iec1meter)) {
-					return accurate_coefficient_to_dB (_iec1meter[n - n_midi]->read());
-				}
+			if (CHECKSIZE(_iec1meter) && n < levels.chn.size()) {
+				return accurate_coefficient_to_dB (levels.chn[n].iec1);
 			}
 			break;
 		case MeterIEC2BBC:
 		case MeterIEC2EBU:
-			{
-				const uint32_t n_midi = current_meters.n_midi();
-				if (CHECKSIZE(_iec2meter)) {
-					return accurate_coefficient_to_dB (_iec2meter[n - n_midi]->read());
-				}
+			if (CHECKSIZE(_iec2meter) && n < levels.chn.size()) {
+				return accurate_coefficient_to_dB (levels.chn[n].iec2);
 			}
 			break;
 		case MeterVU:
-			{
-				const uint32_t n_midi = current_meters.n_midi();
-				if (CHECKSIZE(_vumeter)) {
-					return accurate_coefficient_to_dB (_vumeter[n - n_midi]->read());
-				}
+			if (CHECKSIZE(_vumeter) && n < levels.chn.size()) {
+				return accurate_coefficient_to_dB (levels.chn[n].vu);
 			}
 			break;
 		case MeterPeak:
 		case MeterPeak0dB:
-			if (n < _peak_power.size()) {
-				return _peak_power[n];
+			if (n < n_midi && n < levels.chn.size()) {
+				return levels.chn[n].peak;
+			}
+			if (n < levels.chn.size()) {
+				return accurate_coefficient_to_dB (levels.chn[n].peak);
 			}
 			break;
 		case MeterMCP:
-			mcptmp = _combined_peak;
-			return accurate_coefficient_to_dB(mcptmp);
+			return accurate_coefficient_to_dB (levels.combined_peak);
 		case MeterMaxSignal:
 			assert(0);
 			break;
 		default:
 		case MeterMaxPeak:
-			if (n < _max_peak_signal.size()) {
-				return accurate_coefficient_to_dB(_max_peak_signal[n]);
+			if (n < levels.chn.size()) {
+				return accurate_coefficient_to_dB (levels.chn[n].max_peak);
 			}
 			break;
 	}
 	return minus_infinity();
 }
 
+float
+PeakMeter::rms_level (uint32_t n)
+{
+	Glib::Threads::Mutex::Lock lm (_reader_lock);
+	Levels const& levels (_published.fetch ());
+
+	if (n < current_meters.n_midi() || n >= levels.chn.size()) {
+		return minus_infinity();
+	}
+	return accurate_coefficient_to_dB (levels.chn[n].rms);
+}
+
+float
+PeakMeter::true_peak_level (uint32_t n)
+{
+	Glib::Threads::Mutex::Lock lm (_reader_lock);
+	Levels const& levels (_published.fetch ());
+
+	if (n < current_meters.n_midi() || n >= levels.chn.size()) {
+		return minus_infinity();
+	}
+	return accurate_coefficient_to_dB (levels.chn[n].true_peak);
+}
+
+/** convert @a n coefficients in place, written as a plain loop over
+ * contiguous memory so that the compiler can vectorize it.
+ */
+static void
+coefficients_to_dB (float* buf, uint32_t n)
+{
+	for (uint32_t i = 0; i < n; ++i) {
+		buf[i] = buf[i] < 1e-15f ? -std::numeric_limits<float>::infinity() : 20.0f * log10f (buf[i]);
+	}
+}
+
+void
+PeakMeter::meter_levels (MeterType type, uint32_t n_channels, float* level, float* peak, float* max_peak)
+{
+	Glib::Threads::Mutex::Lock lm (_reader_lock);
+
+	Levels const& levels (_published.fetch ());
+
+	const uint32_t n_midi = min (current_meters.n_midi(), n_channels);
+	const uint32_t n_chn = min (n_channels, (uint32_t) levels.chn.size());
+	bool level_is_peak = false;
+
+	/* gather linear levels */
+	for (uint32_t n = 0; n < n_chn; ++n) {
+		ChannelLevels const& c (levels.chn[n]);
+
+		peak[n] = c.peak;
+		max_peak[n] = c.max_peak;
+
+		switch (type) {
+			case MeterKrms:
+			case MeterK20:
+			case MeterK14:
+			case MeterK12:
+				level[n] = CHECKSIZE(_kmeter) ? c.kmeter : 0;
+				break;
+			case MeterIEC1DIN:
+			case MeterIEC1NOR:
+				level[n] = CHECKSIZE(_iec1meter) ? c.iec1 : 0;
+				break;
+			case MeterIEC2BBC:
+			case MeterIEC2EBU:
+				level[n] = CHECKSIZE(_iec2meter) ? c.iec2 : 0;
+				break;
+			case MeterVU:
+				level[n] = CHECKSIZE(_vumeter) ? c.vu : 0;
+				break;
+			case MeterPeak:
+			case MeterPeak0dB:
+				level_is_peak = true;
+				break;
+			case MeterMCP:
+				level[n] = levels.combined_peak;
+				break;
+			case MeterMaxSignal:
+				assert(0);
+				level[n] = 0;
+				break;
+			default:
+			case MeterMaxPeak:
+				level[n] = c.max_peak;
+				break;
+		}
+	}
+
+	/* MIDI peaks are not in dB */
+	coefficients_to_dB (peak + n_midi, n_chn > n_midi ? n_chn - n_midi : 0);
+	coefficients_to_dB (max_peak, n_chn);
+	if (!level_is_peak) {
+		coefficients_to_dB (level, n_chn);
+	}
+
+	if (level_is_peak) {
+		memcpy (level, peak, n_chn * sizeof (float));
+	}
+
+	for (uint32_t n = n_chn; n < n_channels; ++n) {
+		level[n] = peak[n] = max_peak[n] = minus_infinity();
+	}
+}
+
 void
 PeakMeter::set_meter_type (MeterType t)
 {
@@ -145,6 +145,14 @@ default_copy_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, pframes_t
 	memcpy(dst, src, nframes*sizeof(ARDOUR::Sample));
 }
 
+void
+default_mix_buffers_with_gain_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, const ARDOUR::gain_t * gain, pframes_t nframes)
+{
+	for (pframes_t i = 0; i < nframes; i++) {
+		dst[i] += src[i] * gain[i];
+	}
+}
+
 #if defined (__APPLE__) && defined (BUILD_VECLIB_OPTIMIZATIONS)
 #include <Accelerate/Accelerate.h>
 
@@ -183,6 +191,12 @@ veclib_mix_buffers_no_gain (ARDOUR::Sample * dst, const ARDOUR::Sample * src, pf
 	vDSP_vsma(src, 1, &gain, dst, 1, dst, 1, nframes);
 }
 
+void
+veclib_mix_buffers_with_gain_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, const ARDOUR::gain_t * gain, pframes_t nframes)
+{
+	vDSP_vma(src, 1, gain, 1, dst, 1, dst, 1, nframes);
+}
+
 #endif
 
 
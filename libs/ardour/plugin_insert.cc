@@ -28,6 +28,7 @@
 
 #include <string>
 
+#include "pbd/cycle_trace.h"
 #include "pbd/failed_constructor.h"
 #include "pbd/xml++.h"
 #include "pbd/types_convert.h"
@@ -88,8 +89,9 @@ PluginInsert::PluginInsert (Session& s, boost::shared_ptr<Plugin> plug)
 	, _maps_from_state (false)
 	, _latency_changed (false)
 	, _bypass_port (UINT32_MAX)
-	, _stat_reset (0)
 {
+	_self_timed = true;
+
 	/* the first is the master */
 
 	if (plug) {
@@ -841,6 +843,8 @@ PluginInsert::inplace_silence_unconnected (BufferSet& bufs, const PinMappings& o
 void
 PluginInsert::connect_and_run (BufferSet& bufs, samplepos_t start, samplepos_t end, double speed, pframes_t nframes, samplecnt_t offset, bool with_auto)
 {
+	PBD::CycleTraceScope ts ("plugin", _id.get_id ());
+
 	if (_mapping_changed) { // ToDo use a counter, increment until match
 		_no_inplace = check_inplace ();
 		_mapping_changed = false;
@@ -3297,21 +3301,6 @@ PluginInsert::provides_stats () const
 	return true;
 }
 
-bool
-PluginInsert::get_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const
-{
-	/* TODO: consider taking a try/lock: Don't run concurrently with
-	 * TimingStats::update, TimingStats::reset.
-	 */
-	return _timing_stats.get_stats (min, max, avg, dev);
-}
-
-void
-PluginInsert::clear_stats ()
-{
-	g_atomic_int_set (&_stat_reset, 1);
-}
-
 std::ostream& operator<<(std::ostream& o, const ARDOUR::PluginInsert::Match& m)
 {
 	switch (m.method) {
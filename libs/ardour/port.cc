@@ -47,7 +47,7 @@ pframes_t    Port::_global_port_buffer_offset = 0;
 pframes_t    Port::_cycle_nframes = 0;
 double       Port::_speed_ratio = 1.0;
 std::string  Port::state_node_name = X_("Port");
-const uint32_t Port::_resampler_quality = 12;
+uint32_t     Port::_resampler_quality = 12;
 
 /* a handy define to shorten what would otherwise be a needlessly verbose
  * repeated phrase
@@ -659,6 +659,13 @@ Port::set_speed_ratio (double s) {
 	}
 }
 
+/*static*/ void
+Port::set_resampler_quality (uint32_t q)
+{
+	/* see VMResampler::setup() for min/max range */
+	_resampler_quality = std::min ((uint32_t) 96, std::max ((uint32_t) 8, q));
+}
+
 /*static*/ void
 Port::set_cycle_samplecnt (pframes_t n)
 {
@@ -1374,3 +1374,13 @@ PortManager::set_port_buffer_sizes (pframes_t n)
 		p->second->set_buffer_size (n);
 	}
 }
+
+void
+PortManager::setup_port_resamplers ()
+{
+	boost::shared_ptr<Ports> all = ports.reader();
+
+	for (Ports::iterator p = all->begin(); p != all->end(); ++p) {
+		p->second->setup_resampler ();
+	}
+}
@@ -55,6 +55,8 @@ using namespace PBD;
 
 namespace ARDOUR { class Session; }
 
+volatile gint Processor::_timing_enabled = 0;
+
 // Always saved as Processor, but may be IOProcessor or Send in legacy sessions
 const string Processor::state_node_name = "Processor";
 
@@ -76,6 +78,8 @@ Processor::Processor(Session& session, const string& name)
 	, _capture_offset (0)
 	, _playback_offset (0)
 	, _loop_location (0)
+	, _stat_reset (0)
+	, _self_timed (false)
 {
 }
 
@@ -99,6 +103,8 @@ Processor::Processor (const Processor& other)
 	, _capture_offset (0)
 	, _playback_offset (0)
 	, _loop_location (other._loop_location)
+	, _stat_reset (0)
+	, _self_timed (false)
 {
 }
 
@@ -107,6 +113,27 @@ Processor::~Processor ()
 	DEBUG_TRACE (DEBUG::Destruction, string_compose ("processor %1 destructor\n", _name));
 }
 
+void
+Processor::set_timing_enabled (bool yn)
+{
+	g_atomic_int_set (&_timing_enabled, yn ? 1 : 0);
+}
+
+bool
+Processor::get_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const
+{
+	/* TODO: consider taking a try/lock: Don't run concurrently with
+	 * TimingStats::update, TimingStats::reset.
+	 */
+	return _timing_stats.get_stats (min, max, avg, dev);
+}
+
+void
+Processor::clear_stats ()
+{
+	g_atomic_int_set (&_stat_reset, 1);
+}
+
 XMLNode&
 Processor::get_state (void)
 {
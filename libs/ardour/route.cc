@@ -41,6 +41,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "pbd/xml++.h"
+#include "pbd/cycle_trace.h"
 #include "pbd/enumwriter.h"
 #include "pbd/locale_guard.h"
 #include "pbd/memento_command.h"
@@ -330,6 +331,8 @@ Route::process_output_buffers (BufferSet& bufs,
 	/* Caller must hold process lock */
 	assert (!AudioEngine::instance()->process_lock().trylock());
 
+	PBD::CycleTraceScope ts ("route", _id.get_id ());
+
 	Glib::Threads::RWLock::ReaderLock lm (_processor_lock, Glib::Threads::TRY_LOCK);
 	if (!lm.locked()) {
 		// can this actually happen?
@@ -459,6 +462,7 @@ Route::process_output_buffers (BufferSet& bufs,
 	   ----------------------------------------------------------------------------------------- */
 
 	samplecnt_t latency = 0;
+	const bool timing = Processor::timing_enabled ();
 
 	for (ProcessorList::const_iterator i = _processors.begin(); i != _processors.end(); ++i) {
 
@@ -509,12 +513,20 @@ Route::process_output_buffers (BufferSet& bufs,
 			latency += (*i)->effective_latency ();
 		}
 
+		if (timing) {
+			(*i)->start_timing ();
+		}
+
 		if (speed < 0) {
 			(*i)->run (bufs, start_sample + latency, end_sample + latency, pspeed, nframes, *i != _processors.back());
 		} else {
 			(*i)->run (bufs, start_sample - latency, end_sample - latency, pspeed, nframes, *i != _processors.back());
 		}
 
+		if (timing) {
+			(*i)->update_timing ();
+		}
+
 		bufs.set_count ((*i)->output_streams());
 
 		if (re_inject_oob_data) {
@@ -5158,6 +5170,43 @@ Route::processor_by_id (PBD::ID id) const
 	return boost::shared_ptr<Processor> ();
 }
 
+bool
+Route::get_processor_stats (uint64_t& min, uint64_t& max, double& avg, double& dev) const
+{
+	Glib::Threads::RWLock::ReaderLock lm (_processor_lock);
+
+	bool rv = false;
+	double var = 0;
+	min = max = 0;
+	avg = dev = 0;
+
+	for (ProcessorList::const_iterator i = _processors.begin(); i != _processors.end(); ++i) {
+		uint64_t pmin, pmax;
+		double   pavg, pdev;
+		if (!(*i)->provides_stats () || !(*i)->get_stats (pmin, pmax, pavg, pdev)) {
+			continue;
+		}
+		min += pmin;
+		max += pmax;
+		avg += pavg;
+		var += pdev * pdev;
+		rv = true;
+	}
+
+	dev = sqrt (var);
+	return rv;
+}
+
+void
+Route::clear_processor_stats ()
+{
+	Glib::Threads::RWLock::ReaderLock lm (_processor_lock);
+	for (ProcessorList::const_iterator i = _processors.begin(); i != _processors.end(); ++i) {
+		(*i)->clear_stats ();
+	}
+	clear_process_stats ();
+}
+
 /** @return what we should be metering; either the data coming from the input
  *  IO or the data that is flowing through the route.
  */
@@ -47,6 +47,7 @@
 
 #include "pbd/basename.h"
 #include "pbd/convert.h"
+#include "pbd/cycle_trace.h"
 #include "pbd/error.h"
 #include "pbd/file_utils.h"
 #include "pbd/i18n.h"
@@ -288,6 +289,7 @@ Session::Session (AudioEngine &eng,
 	, _capture_load (0)
 	, _bundles (new BundleList)
 	, _bundle_xml_node (0)
+	, _saved_history_generation (0)
 	, _current_trans (0)
 	, _clicking (false)
 	, _click_rec_only (false)
@@ -545,6 +547,8 @@ Session::destroy ()
 
 	_state_of_the_state = StateOfTheState (CannotSave | Deletion);
 
+	PBD::CycleTrace::set_id_resolver (boost::function<std::string (uint64_t)> ());
+
 	{
 		Glib::Threads::Mutex::Lock lm (AudioEngine::instance()->process_lock ());
 		ltc_tx_cleanup();
@@ -29,6 +29,7 @@
 #include <boost/algorithm/string/erase.hpp>
 
 #include "pbd/i18n.h"
+#include "pbd/cycle_trace.h"
 #include "pbd/error.h"
 #include "pbd/enumwriter.h"
 
@@ -72,6 +73,8 @@ using namespace std;
 void
 Session::process (pframes_t nframes)
 {
+	PBD::CycleTraceScope ts ("session process");
+
 	samplepos_t transport_at_start = _transport_sample;
 
 	_silent = false;
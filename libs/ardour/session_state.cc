@@ -74,6 +74,7 @@
 #include "evoral/SMF.h"
 
 #include "pbd/basename.h"
+#include "pbd/cycle_trace.h"
 #include "pbd/debug.h"
 #include "pbd/enumwriter.h"
 #include "pbd/error.h"
@@ -81,6 +82,7 @@
 #include "pbd/pathexpand.h"
 #include "pbd/pthread_utils.h"
 #include "pbd/stacktrace.h"
+#include "pbd/timing.h"
 #include "pbd/types_convert.h"
 #include "pbd/localtime_r.h"
 #include "pbd/unwind.h"
@@ -192,6 +194,9 @@ Session::pre_engine_init (string fullpath)
 	last_rr_session_dir = session_dirs.begin();
 
 	set_history_depth (Config->get_history_depth());
+	set_history_memory_limit (Config->get_history_memory_limit());
+	set_cycle_trace (Config->get_cycle_trace());
+	Processor::set_timing_enabled (Config->get_processor_timing());
 
 	/* default: assume simple stereo speaker configuration */
 
@@ -837,6 +842,9 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 		tree.set_root (&state (false, fork_state, only_used_assets));
 	}
 
+	/* templates and archives are for interchange, always use XML for those */
+	tree.set_binary (Config->get_binary_session_state () && !template_only && !for_archive);
+
 	if (snapshot_name.empty()) {
 		snapshot_name = _current_snapshot_name;
 	} else if (switch_to_snapshot) {
@@ -1541,6 +1549,9 @@ Session::set_state (const XMLNode& node, int version)
 	XMLNodeList nlist;
 	XMLNode* child;
 	int ret = -1;
+	PBD::Timing load_timing;
+
+	_load_timing.clear ();
 
 	_state_of_the_state = StateOfTheState (_state_of_the_state | CannotSave);
 
@@ -1630,6 +1641,8 @@ Session::set_state (const XMLNode& node, int version)
 		_speakers->set_state (*child, version);
 	}
 
+	load_timing.start ();
+
 	if ((child = find_named_node (node, "Sources")) == 0) {
 		error << _("Session: XML state has no sources section") << endmsg;
 		goto out;
@@ -1637,6 +1650,8 @@ Session::set_state (const XMLNode& node, int version)
 		goto out;
 	}
 
+	add_load_timing (load_timing, X_("Sources"));
+
 	if ((child = find_named_node (node, "TempoMap")) == 0) {
 		error << _("Session: XML state has no Tempo Map section") << endmsg;
 		goto out;
@@ -1657,6 +1672,8 @@ Session::set_state (const XMLNode& node, int version)
 		AudioFileSource::set_header_position_offset (_session_range_location->start());
 	}
 
+	add_load_timing (load_timing, X_("TempoMap, Locations"));
+
 	if ((child = find_named_node (node, "Regions")) == 0) {
 		error << _("Session: XML state has no Regions section") << endmsg;
 		goto out;
@@ -1664,6 +1681,8 @@ Session::set_state (const XMLNode& node, int version)
 		goto out;
 	}
 
+	add_load_timing (load_timing, X_("Regions"));
+
 	if ((child = find_named_node (node, "Playlists")) == 0) {
 		error << _("Session: XML state has no playlists section") << endmsg;
 		goto out;
@@ -1677,6 +1696,8 @@ Session::set_state (const XMLNode& node, int version)
 		goto out;
 	}
 
+	add_load_timing (load_timing, X_("Playlists"));
+
 	if ((child = find_named_node (node, "CompoundAssociations")) != 0) {
 		if (load_compounds (*child)) {
 			goto out;
@@ -1720,6 +1741,8 @@ Session::set_state (const XMLNode& node, int version)
 		goto out;
 	}
 
+	add_load_timing (load_timing, X_("Routes"));
+
 	/* Now that we Tracks have been loaded and playlists are assigned */
 	_playlists->update_tracking ();
 
@@ -1786,6 +1809,8 @@ Session::set_state (const XMLNode& node, int version)
 
 	update_route_record_state ();
 
+	add_load_timing (load_timing, X_("Groups, Surfaces, Scripts"));
+
 	/* here beginneth the second phase ... */
 	set_snapshot_name (_current_snapshot_name);
 
@@ -1801,6 +1826,14 @@ out:
 	return ret;
 }
 
+void
+Session::add_load_timing (PBD::Timing& t, std::string const& stage)
+{
+	t.update ();
+	_load_timing.push_back (std::make_pair (stage, t.elapsed ()));
+	t.start ();
+}
+
 int
 Session::load_routes (const XMLNode& node, int version)
 {
@@ -2371,11 +2404,26 @@ Session::load_sources (const XMLNode& node)
 	set_dirty();
 	std::map<std::string, std::string> relocation;
 
-	for (niter = nlist.begin(); niter != nlist.end(); ++niter) {
+	/* open audio files concurrently; anything that could not be
+	 * created that way is handled below, in order, as before.
+	 */
+	std::vector<boost::shared_ptr<Source> > preloaded;
+	SourceFactory::preload (*this, nlist, preloaded);
+
+	size_t n = 0;
+	for (niter = nlist.begin(); niter != nlist.end(); ++niter, ++n) {
 #ifdef PLATFORM_WINDOWS
 		int old_mode = 0;
 #endif
 
+		if (n < preloaded.size () && preloaded[n]) {
+			/* note: do peak building in another thread when loading session state */
+			if (SourceFactory::announce (preloaded[n], true)) {
+				error << _("Session: cannot create Source from XML description.") << endmsg;
+			}
+			continue;
+		}
+
 		XMLNode srcnode (**niter);
 		bool try_replace_abspath = true;
 
@@ -3838,6 +3886,12 @@ Session::save_history (string snapshot_name)
 	const std::string xml_path(Glib::build_filename (_session_dir->root_path(), history_filename));
 	const std::string backup_path(Glib::build_filename (_session_dir->root_path(), backup_filename));
 
+	/* the history only changes by editing, don't rewrite an unchanged file */
+	if (xml_path == _saved_history_path && _history.generation () == _saved_history_generation
+	    && Glib::file_test (xml_path, Glib::FILE_TEST_EXISTS)) {
+		return 0;
+	}
+
 	if (Glib::file_test (xml_path, Glib::FILE_TEST_EXISTS)) {
 		if (::g_rename (xml_path.c_str(), backup_path.c_str()) != 0) {
 			error << _("could not backup old history file, current history not saved") << endmsg;
@@ -3868,6 +3922,9 @@ Session::save_history (string snapshot_name)
 		return -1;
 	}
 
+	_saved_history_path = xml_path;
+	_saved_history_generation = _history.generation ();
+
 	return 0;
 }
 
@@ -4157,6 +4214,15 @@ Session::config_changed (std::string p, bool ours)
 		setup_fpu ();
 	} else if (p == "history-depth") {
 		set_history_depth (Config->get_history_depth());
+	} else if (p == "history-memory-limit") {
+		set_history_memory_limit (Config->get_history_memory_limit());
+	} else if (p == "cycle-trace") {
+		set_cycle_trace (Config->get_cycle_trace());
+	} else if (p == "processor-timing") {
+		Processor::set_timing_enabled (Config->get_processor_timing());
+	} else if (p == "save-history" || p == "save-history-depth") {
+		/* force the next save to rewrite the history file */
+		_saved_history_path.clear ();
 	} else if (p == "remote-model") {
 		/* XXX DO SOMETHING HERE TO TELL THE GUI THAT WE NEED
 		   TO SET REMOTE ID'S
@@ -4234,6 +4300,57 @@ Session::set_history_depth (uint32_t d)
 	_history.set_depth (d);
 }
 
+void
+Session::set_history_memory_limit (uint32_t mib)
+{
+	_history.set_memory_limit ((size_t) mib * 1048576);
+}
+
+void
+Session::set_cycle_trace (bool yn)
+{
+	if (yn) {
+		PBD::CycleTrace::set_id_resolver (boost::bind (&Session::cycle_trace_name, this, _1));
+	}
+	PBD::CycleTrace::set_enabled (yn);
+}
+
+std::string
+Session::cycle_trace_name (uint64_t id) const
+{
+	boost::shared_ptr<Route> r = route_by_id (PBD::ID (id));
+	if (r) {
+		return r->name ();
+	}
+	boost::shared_ptr<Processor> p = processor_by_id (PBD::ID (id));
+	if (p) {
+		return p->name ();
+	}
+	return std::string ();
+}
+
+/** Write the per-thread cycle trace rings to the session folder.
+ * Called by the butler after an xrun, when tracing is enabled.
+ */
+void
+Session::write_cycle_trace ()
+{
+	char timebuf[128];
+	time_t n;
+	struct tm local_time;
+	time (&n);
+	localtime_r (&n, &local_time);
+	strftime (timebuf, sizeof(timebuf), "%Y-%m-%d_%H.%M.%S", &local_time);
+
+	std::string path = Glib::build_filename (session_directory().root_path(), string_compose ("cycle-trace-%1.json", timebuf));
+
+	if (PBD::CycleTrace::write (path)) {
+		info << string_compose (_("Wrote cycle trace to \"%1\""), path) << endmsg;
+	} else {
+		error << string_compose (_("Could not write cycle trace to \"%1\" (%2)"), path, g_strerror (errno)) << endmsg;
+	}
+}
+
 /** Connect things to the MMC object */
 void
 Session::setup_midi_machine_control ()
@@ -4559,36 +4676,24 @@ Session::get_info_from_path (const string& xmlpath, float& sample_rate, SampleFo
 		return -1;
 	}
 
-	xmlParserCtxtPtr ctxt = xmlNewParserCtxt();
-	if (ctxt == NULL) {
-		return -1;
-	}
-	xmlDocPtr doc = xmlCtxtReadFile (ctxt, xmlpath.c_str(), NULL, XML_PARSE_HUGE);
-
-	if (doc == NULL) {
-		xmlFreeParserCtxt(ctxt);
+	/* XMLTree handles both the XML and the binary session state encoding */
+	XMLTree tree;
+	if (!tree.read (xmlpath)) {
 		return -1;
 	}
 
-	xmlNodePtr node = xmlDocGetRootElement(doc);
+	XMLNode const* root = tree.root ();
 
-	if (node == NULL) {
-		xmlFreeParserCtxt(ctxt);
-		xmlFreeDoc (doc);
+	if (root == NULL) {
 		return -1;
 	}
 
 	/* sample rate & version*/
 
-	xmlAttrPtr attr;
-	for (attr = node->properties; attr; attr = attr->next) {
-		if (!strcmp ((const char*)attr->name, "version") && attr->children) {
-			version = std::string ((char*)attr->children->content);
-		}
-		if (!strcmp ((const char*)attr->name, "sample-rate") && attr->children) {
-			sample_rate = atoi ((char*)attr->children->content);
-			found_sr = true;
-		}
+	root->get_property ("version", version);
+
+	if (root->get_property ("sample-rate", sample_rate)) {
+		found_sr = true;
 	}
 
 	if ((parse_stateful_loading_version(version) / 1000L) > (CURRENT_SESSION_FILE_VERSION / 1000L)) {
@@ -4601,45 +4706,33 @@ Session::get_info_from_path (const string& xmlpath, float& sample_rate, SampleFo
 		found_data_format = true;
 	}
 
-	node = node->children;
-	while (node != NULL) {
-		 if (!strcmp((const char*) node->name, "ProgramVersion")) {
-			 xmlChar* val = xmlGetProp (node, (const xmlChar*)"modified-with");
-			 if (val) {
-				 program_version = string ((const char*)val);
-				 size_t sep = program_version.find_first_of("-");
-				 if (sep != string::npos) {
-					 program_version = program_version.substr (0, sep);
-				 }
-			 }
-			 xmlFree (val);
-		 }
-		 if (strcmp((const char*) node->name, "Config")) {
-			 node = node->next;
-			 continue;
-		 }
-		 for (node = node->children; node; node = node->next) {
-			 xmlChar* pv = xmlGetProp (node, (const xmlChar*)"name");
-			 if (pv && !strcmp ((const char*)pv, "native-file-data-format")) {
-				 xmlFree (pv);
-				 xmlChar* val = xmlGetProp (node, (const xmlChar*)"value");
-				 if (val) {
-					 try {
-						 SampleFormat fmt = (SampleFormat) string_2_enum (string ((const char*)val), fmt);
-						 data_format = fmt;
-						 found_data_format = true;
-					 } catch (PBD::unknown_enumeration& e) {}
-				 }
-				 xmlFree (val);
-				 break;
-			 }
-			 xmlFree (pv);
-		 }
-		 break;
-	}
-
-	xmlFreeParserCtxt(ctxt);
-	xmlFreeDoc (doc);
+	XMLNode const* pv = root->child ("ProgramVersion");
+	if (pv && pv->get_property ("modified-with", program_version)) {
+		size_t sep = program_version.find_first_of("-");
+		if (sep != string::npos) {
+			program_version = program_version.substr (0, sep);
+		}
+	}
+
+	XMLNode const* config = root->child ("Config");
+	if (config) {
+		XMLNodeList const& options (config->children ());
+		for (XMLNodeConstIterator i = options.begin (); i != options.end (); ++i) {
+			std::string name;
+			if (!(*i)->get_property ("name", name) || name != "native-file-data-format") {
+				continue;
+			}
+			std::string val;
+			if ((*i)->get_property ("value", val)) {
+				try {
+					SampleFormat fmt = (SampleFormat) string_2_enum (val, fmt);
+					data_format = fmt;
+					found_data_format = true;
+				} catch (PBD::unknown_enumeration& e) {}
+			}
+			break;
+		}
+	}
 
 	return (found_sr && found_data_format) ? 0 : 1;
 }
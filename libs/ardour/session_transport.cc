@@ -34,6 +34,7 @@
 
 #include <boost/algorithm/string/erase.hpp>
 
+#include "pbd/cycle_trace.h"
 #include "pbd/error.h"
 #include "pbd/enumwriter.h"
 #include "pbd/i18n.h"
@@ -1825,6 +1826,11 @@ Session::xrun_recovery ()
 
 	Xrun (_transport_sample); /* EMIT SIGNAL */
 
+	if (PBD::CycleTrace::enabled ()) {
+		PBD::CycleTrace::request_dump ();
+		_butler->summon ();
+	}
+
 	if (Config->get_stop_recording_on_xrun() && actively_recording()) {
 
 		/* it didn't actually halt, but we need
@@ -26,6 +26,7 @@
 
 #include "pbd/error.h"
 #include "pbd/convert.h"
+#include "pbd/cpus.h"
 #include "pbd/pthread_utils.h"
 #include "pbd/stacktrace.h"
 
@@ -135,6 +136,119 @@ SourceFactory::setup_peakfile (boost::shared_ptr<Source> s, bool async)
 	return 0;
 }
 
+namespace {
+
+struct PreloadJob {
+	PreloadJob (Session& s, std::vector<XMLNode const*> const& n, std::vector<boost::shared_ptr<Source> >& r)
+		: session (s)
+		, nodes (n)
+		, result (r)
+		, next (0)
+	{}
+
+	Session& session;
+	std::vector<XMLNode const*> const& nodes;
+	std::vector<boost::shared_ptr<Source> >& result;
+	gint next;
+};
+
+}
+
+static void
+preload_thread_work (PreloadJob* job)
+{
+	pthread_set_name ("SourcePreload");
+
+	/* ambiguous file names are resolved by asking the user later */
+	FileSource::disallow_questions_in_this_thread ();
+
+	while (true) {
+		const gint n = g_atomic_int_add (&job->next, 1);
+		if (n >= (gint) job->nodes.size ()) {
+			break;
+		}
+
+		XMLNode const* node = job->nodes[n];
+		if (!node) {
+			continue;
+		}
+
+		/* constructing the source opens the file and parses its header,
+		 * which is the expensive part. Peakfiles are checked by the peak
+		 * building threads when the source is announced.
+		 */
+		try {
+			boost::shared_ptr<Source> ret (new SndFileSource (job->session, *node));
+			BOOST_MARK_SOURCE (ret);
+			ret->check_for_analysis_data_on_disk ();
+			job->result[n] = ret;
+		} catch (...) {
+			/* handled by the caller, using SourceFactory::create() */
+		}
+	}
+}
+
+void
+SourceFactory::preload (Session& s, XMLNodeList const& nodes, std::vector<boost::shared_ptr<Source> >& result)
+{
+	std::vector<XMLNode const*> audio_nodes;
+
+	result.clear ();
+	result.resize (nodes.size ());
+	audio_nodes.reserve (nodes.size ());
+
+	size_t n_audio = 0;
+
+	for (XMLNodeConstIterator i = nodes.begin (); i != nodes.end (); ++i) {
+		XMLNode const* node = *i;
+		std::string type;
+		if (node->name () != X_("Source")
+		    || (node->get_property (X_("type"), type) && DataType (type) != DataType::AUDIO)
+		    || node->property (X_("playlist"))) {
+			/* only plain audio files are opened concurrently */
+			audio_nodes.push_back (0);
+		} else {
+			audio_nodes.push_back (node);
+			++n_audio;
+		}
+	}
+
+	const uint32_t n_threads = std::min ((uint32_t) std::min (n_audio / 32, (size_t) 16), hardware_concurrency ());
+
+	if (n_threads < 2) {
+		/* not worth it */
+		return;
+	}
+
+	PreloadJob job (s, audio_nodes, result);
+	std::vector<Glib::Threads::Thread*> threads;
+
+	for (uint32_t n = 0; n < n_threads; ++n) {
+		try {
+			threads.push_back (Glib::Threads::Thread::create (sigc::bind (sigc::ptr_fun (preload_thread_work), &job)));
+		} catch (...) {
+			break;
+		}
+	}
+
+	/* if no thread could be started, result remains empty and
+	 * the caller creates all sources itself */
+	for (std::vector<Glib::Threads::Thread*>::iterator t = threads.begin (); t != threads.end (); ++t) {
+		(*t)->join ();
+	}
+}
+
+int
+SourceFactory::announce (boost::shared_ptr<Source> src, bool async)
+{
+	if (setup_peakfile (src, async)) {
+		return -1;
+	}
+
+	SourceCreated (src);
+	return 0;
+}
+
 boost::shared_ptr<Source>
 SourceFactory::createSilent (Session& s, const XMLNode& node, samplecnt_t nframes, float sr)
 {
@@ -115,3 +115,32 @@ x86_sse_avx_find_peaks(const float* buf, uint32_t nframes, float *min, float *ma
 }
 
 
+
+void
+x86_sse_avx_mix_buffers_with_gain_vector (float* dst, const float* src, const float* gain, uint32_t nframes)
+{
+	__m256 d, s, g;
+
+	/* automation and pan buffers are not necessarily aligned
+	 * to the audio buffers, so use unaligned loads throughout */
+	while (nframes >= 8) {
+		d = _mm256_loadu_ps (dst);
+		s = _mm256_loadu_ps (src);
+		g = _mm256_loadu_ps (gain);
+		d = _mm256_add_ps (d, _mm256_mul_ps (s, g));
+		_mm256_storeu_ps (dst, d);
+
+		dst += 8;
+		src += 8;
+		gain += 8;
+		nframes -= 8;
+	}
+
+	while (nframes > 0) {
+		*dst++ += *src++ * *gain++;
+		--nframes;
+	}
+
+	// zero upper 128 bit of 256 bit ymm register to avoid penalties using non-AVX instructions
+	_mm256_zeroupper ();
+}
@@ -48,6 +48,12 @@ x86_sse_avx_copy_vector (float * dst, const float * src, uint32_t nframes)
 	default_copy_vector (dst, src, nframes);
 }
 
+void
+x86_sse_avx_mix_buffers_with_gain_vector (float * dst, const float * src, const float * gain, uint32_t nframes)
+{
+	default_mix_buffers_with_gain_vector (dst, src, gain, nframes);
+}
+
 void
 x86_sse_avx_find_peaks (const float * buf, uint32_t nsamples, float *min, float *max)
 {
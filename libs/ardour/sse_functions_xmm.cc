@@ -116,3 +116,29 @@ x86_sse_find_peaks(const ARDOUR::Sample* buf, ARDOUR::pframes_t nframes, float *
 
 
 
+
+void
+x86_sse_mix_buffers_with_gain_vector (float* dst, const float* src, const float* gain, uint32_t nframes)
+{
+	__m128 d, s, g;
+
+	/* automation and pan buffers are not necessarily aligned
+	 * to the audio buffers, so use unaligned loads throughout */
+	while (nframes >= 4) {
+		d = _mm_loadu_ps (dst);
+		s = _mm_loadu_ps (src);
+		g = _mm_loadu_ps (gain);
+		d = _mm_add_ps (d, _mm_mul_ps (s, g));
+		_mm_storeu_ps (dst, d);
+
+		dst += 4;
+		src += 4;
+		gain += 4;
+		nframes -= 4;
+	}
+
+	while (nframes > 0) {
+		*dst++ += *src++ * *gain++;
+		--nframes;
+	}
+}
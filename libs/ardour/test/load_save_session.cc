@@ -5,12 +5,18 @@
 
 #include <glib.h>
 
+#include <glibmm/miscutils.h>
+
 #include "pbd/failed_constructor.h"
 #include "pbd/timing.h"
+#include "pbd/xml++.h"
 
 #include "ardour/ardour.h"
 #include "ardour/audioengine.h"
+#include "ardour/filename_extensions.h"
+#include "ardour/rc_configuration.h"
 #include "ardour/session.h"
+#include "ardour/utils.h"
 
 #include "test_ui.h"
 
@@ -96,6 +102,40 @@ int main (int argc, char* argv[])
 	std::cerr << "Saving session time : " << save_session_timing.elapsed()
 	          << " usecs" << std::endl;
 
+	/* compare with the binary session state format, saved as a
+	 * separate snapshot to leave the original untouched */
+
+	const std::string binary_snapshot = std::string (argv[2]) + "-binary";
+
+	Config->set_binary_session_state (true);
+
+	PBD::Timing save_binary_timing;
+
+	s->save_state (binary_snapshot);
+
+	save_binary_timing.update();
+
+	Config->set_binary_session_state (false);
+
+	std::cerr << "Saving binary session time : " << save_binary_timing.elapsed()
+	          << " usecs" << std::endl;
+
+	const std::string xml_path = Glib::build_filename (argv[1], legalize_for_path (argv[2]) + statefile_suffix);
+	const std::string bin_path = Glib::build_filename (argv[1], legalize_for_path (binary_snapshot) + statefile_suffix);
+
+	PBD::Timing read_xml_timing;
+	XMLTree xml_tree (xml_path);
+	read_xml_timing.update();
+
+	PBD::Timing read_binary_timing;
+	XMLTree binary_tree (bin_path);
+	read_binary_timing.update();
+
+	std::cerr << "Reading session state (XML) : " << read_xml_timing.elapsed()
+	          << " usecs" << std::endl;
+	std::cerr << "Reading session state (binary) : " << read_binary_timing.elapsed()
+	          << " usecs" << std::endl;
+
 	std::cerr << "AudioEngine::remove_session" << std::endl;
 
 	AudioEngine::instance()->remove_session ();
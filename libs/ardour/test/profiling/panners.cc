@@ -0,0 +1,109 @@
+#include <iostream>
+#include <cmath>
+#include <glib.h>
+
+#include "pbd/compose.h"
+
+#include "ardour/ardour.h"
+#include "ardour/audio_buffer.h"
+#include "ardour/buffer_set.h"
+#include "ardour/pannable.h"
+#include "ardour/panner.h"
+#include "ardour/panner_manager.h"
+#include "ardour/session.h"
+#include "ardour/speakers.h"
+#include "test_util.h"
+
+using namespace std;
+using namespace PBD;
+using namespace ARDOUR;
+
+static const char* localedir = LOCALEDIR;
+
+static const pframes_t nframes = 1024;
+static const int cycles = 10000;
+
+/** @return average time in microseconds to pan one cycle */
+static double
+run (Panner* panner, BufferSet& inbufs, BufferSet& outbufs, pan_t** pan_buffers, bool automated)
+{
+	int64_t const start_time = g_get_monotonic_time ();
+
+	for (int i = 0; i < cycles; ++i) {
+		samplepos_t const start = i * nframes;
+
+		for (BufferSet::audio_iterator b = outbufs.audio_begin(); b != outbufs.audio_end(); ++b) {
+			b->silence (nframes);
+		}
+
+		if (automated) {
+			panner->distribute_automated (inbufs, outbufs, start, start + nframes, nframes, pan_buffers);
+		} else {
+			panner->distribute (inbufs, outbufs, 1.0, nframes);
+		}
+	}
+
+	return (g_get_monotonic_time () - start_time) / (double) cycles;
+}
+
+int
+main (int argc, char* argv[])
+{
+	ARDOUR::init (false, true, localedir);
+	Session* session = load_session ("../libs/ardour/test/profiling/sessions/1region", "1region");
+
+	pan_t* pan_buffers[2];
+	pan_buffers[0] = new pan_t[nframes];
+	pan_buffers[1] = new pan_t[nframes];
+
+	std::list<PannerInfo*>& panners (PannerManager::instance().panner_info);
+
+	for (std::list<PannerInfo*>::iterator p = panners.begin(); p != panners.end(); ++p) {
+
+		PanPluginDescriptor& d ((*p)->descriptor);
+
+		/* -1 means "any", use a typical surround setup for those */
+		uint32_t const n_in  = d.in > 0 ? d.in : 2;
+		uint32_t const n_out = d.out > 0 ? d.out : 8;
+
+		boost::shared_ptr<Speakers> speakers (new Speakers);
+		speakers->setup_default_speakers (n_out);
+
+		boost::shared_ptr<Pannable> pannable (new Pannable (*session));
+		Panner* panner = d.factory (pannable, speakers);
+		panner->configure_io (ChanCount (DataType::AUDIO, n_in), ChanCount (DataType::AUDIO, n_out));
+
+		/* the automated case sweeps from left to right over the whole run */
+		pannable->pan_azimuth_control->list()->fast_simple_add (0, 0);
+		pannable->pan_azimuth_control->list()->fast_simple_add (cycles * nframes, 1);
+		pannable->pan_width_control->list()->fast_simple_add (0, 1);
+		pannable->pan_width_control->list()->fast_simple_add (cycles * nframes, 0);
+
+		BufferSet inbufs;
+		BufferSet outbufs;
+		inbufs.ensure_buffers (DataType::AUDIO, n_in, nframes);
+		inbufs.set_count (ChanCount (DataType::AUDIO, n_in));
+		outbufs.ensure_buffers (DataType::AUDIO, n_out, nframes);
+		outbufs.set_count (ChanCount (DataType::AUDIO, n_out));
+
+		for (uint32_t c = 0; c < n_in; ++c) {
+			Sample* data = inbufs.get_audio (c).data ();
+			for (pframes_t n = 0; n < nframes; ++n) {
+				data[n] = sinf (n * (c + 1) * 2.f * M_PI / nframes);
+			}
+		}
+
+		double const static_time = run (panner, inbufs, outbufs, pan_buffers, false);
+		double const automated_time = run (panner, inbufs, outbufs, pan_buffers, true);
+
+		cout << string_compose ("%1 (%2 in, %3 out): static %4 us, automated %5 us per %6 samples\n",
+		                        d.name, n_in, n_out, static_time, automated_time, nframes);
+
+		delete panner;
+	}
+
+	delete [] pan_buffers[0];
+	delete [] pan_buffers[1];
+
+	return 0;
+}
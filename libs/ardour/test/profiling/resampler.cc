@@ -0,0 +1,103 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <glib.h>
+
+#include "pbd/compose.h"
+
+#include "zita-resampler/vmresampler.h"
+
+#include "ardour/types.h"
+
+using namespace std;
+using namespace ARDOUR;
+
+/* Compare CPU cost and quality of the varispeed resampler used by
+ * AudioPort at the available quality settings, for small speed
+ * corrections (as used when chasing timecode) and for double speed.
+ */
+
+static const pframes_t nframes = 1024;
+static const int cycles = 2000;
+static const double freq = 997.0 / 48000.0;
+
+/** signal to noise ratio of @a data compared to a sine of @a f,
+ * the best fitting amplitude and phase are used as reference.
+ */
+static double
+snr (vector<float> const& data, double f)
+{
+	/* skip the start, the resampler ratio is filtered */
+	size_t const start = data.size () / 2;
+	double ss = 0, cc = 0, sc = 0, ys = 0, yc = 0;
+
+	for (size_t i = start; i < data.size (); ++i) {
+		double const s = sin (2 * M_PI * f * i);
+		double const c = cos (2 * M_PI * f * i);
+		ss += s * s;
+		cc += c * c;
+		sc += s * c;
+		ys += data[i] * s;
+		yc += data[i] * c;
+	}
+
+	double const det = ss * cc - sc * sc;
+	double const a = (ys * cc - yc * sc) / det;
+	double const b = (yc * ss - ys * sc) / det;
+
+	double signal = 0, noise = 0;
+
+	for (size_t i = start; i < data.size (); ++i) {
+		double const ref = a * sin (2 * M_PI * f * i) + b * cos (2 * M_PI * f * i);
+		signal += ref * ref;
+		noise += (data[i] - ref) * (data[i] - ref);
+	}
+
+	return 10 * log10 (signal / noise);
+}
+
+int
+main (int argc, char* argv[])
+{
+	uint32_t const qualities[] = { 8, 12, 24, 48 };
+	double const speeds[] = { 0.99, 0.999, 1.001, 1.01, 2.0 };
+
+	vector<Sample> input (nframes * cycles);
+
+	for (size_t i = 0; i < input.size (); ++i) {
+		input[i] = sin (2 * M_PI * freq * i);
+	}
+
+	for (size_t q = 0; q < sizeof (qualities) / sizeof (qualities[0]); ++q) {
+		for (size_t s = 0; s < sizeof (speeds) / sizeof (speeds[0]); ++s) {
+
+			/* as in AudioPort::cycle_start () */
+			pframes_t const out_frames = lrint (nframes * speeds[s]);
+			double const ratio = out_frames / (double) nframes;
+
+			ArdourZita::VMResampler src;
+			src.setup (qualities[q]);
+			src.set_rrfilt (10);
+
+			vector<Sample> output (out_frames * cycles);
+
+			int64_t const start_time = g_get_monotonic_time ();
+
+			for (int c = 0; c < cycles; ++c) {
+				src.inp_data  = &input[c * nframes];
+				src.inp_count = nframes;
+				src.out_data  = &output[c * out_frames];
+				src.out_count = out_frames;
+				src.set_rratio (ratio);
+				src.process ();
+			}
+
+			double const elapsed = (g_get_monotonic_time () - start_time) / (double) cycles;
+
+			cout << string_compose ("quality %1 speed %2: %3 us per %4 samples, SNR %5 dB\n",
+			                        qualities[q], speeds[s], elapsed, nframes, snr (output, freq / ratio));
+		}
+	}
+
+	return 0;
+}
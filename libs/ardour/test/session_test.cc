@@ -6,6 +6,9 @@
 
 #include "pbd/textreceiver.h"
 #include "pbd/file_utils.h"
+#include "pbd/xml++.h"
+#include "ardour/filename_extensions.h"
+#include "ardour/rc_configuration.h"
 #include "ardour/session.h"
 #include "ardour/audioengine.h"
 #include "ardour/smf_source.h"
@@ -150,3 +153,58 @@ SessionTest::open_session_utf8_path ()
 	}
 
 }
+
+void
+SessionTest::save_reopen_binary_session ()
+{
+	const string session_name("binary_session");
+	std::string new_session_dir = Glib::build_filename (new_test_output_dir(), session_name);
+	std::string statefile = Glib::build_filename (new_session_dir, session_name + statefile_suffix);
+
+	CPPUNIT_ASSERT (!Glib::file_test (new_session_dir, Glib::FILE_TEST_EXISTS));
+
+	create_and_start_dummy_backend ();
+
+	Session* session = load_session (new_session_dir, session_name);
+	CPPUNIT_ASSERT (session);
+
+	Config->set_binary_session_state (true);
+	CPPUNIT_ASSERT_EQUAL (0, session->save_state (""));
+	Config->set_binary_session_state (false);
+
+	delete session;
+	stop_and_destroy_backend ();
+
+	CPPUNIT_ASSERT (XMLTree::is_binary_file (statefile));
+
+	/* used by the session dialog before a session is opened */
+	float sample_rate = 0;
+	SampleFormat data_format;
+	std::string program_version;
+	CPPUNIT_ASSERT_EQUAL (0, Session::get_info_from_path (statefile, sample_rate, data_format, program_version));
+	CPPUNIT_ASSERT (sample_rate > 0);
+	CPPUNIT_ASSERT (!program_version.empty ());
+
+	create_and_start_dummy_backend ();
+
+	bool open_session_failed = false;
+
+	try {
+		session = new Session (*AudioEngine::instance (), new_session_dir, session_name);
+	} catch (...) {
+		open_session_failed = true;
+		session = 0;
+	}
+
+	CPPUNIT_ASSERT (!open_session_failed);
+	CPPUNIT_ASSERT (session);
+
+	/* a regular save converts the session back to XML */
+	CPPUNIT_ASSERT_EQUAL (0, session->save_state (""));
+
+	delete session;
+	stop_and_destroy_backend ();
+
+	CPPUNIT_ASSERT (!XMLTree::is_binary_file (statefile));
+	CPPUNIT_ASSERT_EQUAL (0, Session::get_info_from_path (statefile, sample_rate, data_format, program_version));
+}
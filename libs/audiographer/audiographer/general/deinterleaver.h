@@ -6,6 +6,7 @@
 #include "audiographer/source.h"
 #include "audiographer/sink.h"
 #include "audiographer/exception.h"
+#include "audiographer/type_utils.h"
 #include "audiographer/utils/identity_vertex.h"
 
 #include <vector>
@@ -77,9 +78,7 @@ class /*LIBAUDIOGRAPHER_API*/ DeInterleaver
 		for (typename std::vector<OutputPtr>::iterator it = outputs.begin(); it != outputs.end(); ++it, ++channel) {
 			if (!*it) { continue; }
 
-			for (unsigned int i = 0; i < samples_per_channel; ++i) {
-				buffer[i] = data[channel + (channels * i)];
-			}
+			TypeUtils<T>::deinterleave_channel (data, buffer, channel, channels, samples_per_channel);
 
 			ProcessContext<T> c_out (c, buffer, samples_per_channel, 1);
 			(*it)->process (c_out);
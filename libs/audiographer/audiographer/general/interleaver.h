@@ -6,6 +6,7 @@
 #include "audiographer/sink.h"
 #include "audiographer/exception.h"
 #include "audiographer/throwing.h"
+#include "audiographer/type_utils.h"
 #include "audiographer/utils/listed_source.h"
 
 #include <vector>
@@ -112,9 +113,7 @@ class /*LIBAUDIOGRAPHER_API*/ Interleaver
 			throw Exception (*this, "Too many samples given to an input");
 		}
 
-		for (unsigned int i = 0; i < c.samples(); ++i) {
-			buffer[channel + (channels * i)] = c.data()[i];
-		}
+		TypeUtils<T>::interleave_channel (c.data(), buffer, channel, channels, c.samples());
 
 		samplecnt_t const ready_samples = ready_to_output();
 		if (ready_samples) {
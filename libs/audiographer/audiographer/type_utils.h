@@ -64,6 +64,66 @@ class /*LIBAUDIOGRAPHER_API*/ TypeUtils : private TypeUtilsBase
 			std::copy_backward (source, &source[samples], destination + samples);
 		}
 	}
+
+	/** Writes \a samples frames of a single channel from \a source into
+	  * the interleaved buffer \a destination, which holds \a channels channels.
+	  * Common channel counts use a fixed stride, which the compiler vectorizes.
+	  * \n RT safe
+	  */
+	inline static void interleave_channel (T const * source, T * destination, unsigned int channel, unsigned int channels, samplecnt_t samples)
+	{
+		T * dst = &destination[channel];
+		switch (channels) {
+			case 1:  copy (source, dst, samples); break;
+			case 2:  do_interleave<2> (source, dst, samples); break;
+			case 4:  do_interleave<4> (source, dst, samples); break;
+			case 6:  do_interleave<6> (source, dst, samples); break;
+			case 8:  do_interleave<8> (source, dst, samples); break;
+			default:
+				for (samplecnt_t i = 0; i < samples; ++i) {
+					dst[channels * i] = source[i];
+				}
+				break;
+		}
+	}
+
+	/** Reads \a samples frames of channel \a channel from the interleaved
+	  * buffer \a source (holding \a channels channels) into \a destination.
+	  * \n RT safe
+	  */
+	inline static void deinterleave_channel (T const * source, T * destination, unsigned int channel, unsigned int channels, samplecnt_t samples)
+	{
+		T const * src = &source[channel];
+		switch (channels) {
+			case 1:  copy (src, destination, samples); break;
+			case 2:  do_deinterleave<2> (src, destination, samples); break;
+			case 4:  do_deinterleave<4> (src, destination, samples); break;
+			case 6:  do_deinterleave<6> (src, destination, samples); break;
+			case 8:  do_deinterleave<8> (src, destination, samples); break;
+			default:
+				for (samplecnt_t i = 0; i < samples; ++i) {
+					destination[i] = src[channels * i];
+				}
+				break;
+		}
+	}
+
+  private:
+	template<unsigned int N>
+	inline static void do_interleave (T const * __restrict source, T * __restrict destination, samplecnt_t samples)
+	{
+		for (samplecnt_t i = 0; i < samples; ++i) {
+			destination[N * i] = source[i];
+		}
+	}
+
+	template<unsigned int N>
+	inline static void do_deinterleave (T const * __restrict source, T * __restrict destination, samplecnt_t samples)
+	{
+		for (samplecnt_t i = 0; i < samples; ++i) {
+			destination[i] = source[N * i];
+		}
+	}
 };
 
 
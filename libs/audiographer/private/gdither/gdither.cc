@@ -45,6 +45,10 @@
 #include <assert.h>
 #include <sys/types.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /* Lipshitz's minimally audible FIR, only really works for 46kHz-ish signals */
 static const float shaped_bs[] = { 2.033f, -2.165f, 1.959f, -1.590f, 0.6149f };
 
@@ -61,12 +65,18 @@ static const float shaped_bs[] = { 2.033f, -2.165f, 1.959f, -1.590f, 0.6149f };
 #define MIN_S24  -8388608
 #define SCALE_S24 8388608.0f
 
+static uint32_t gdither_rnd = 23232323;
+
 inline static float gdither_noise ()
 {
-	static uint32_t rnd = 23232323;
-	rnd = (rnd * 196314165) + 907633515;
+	gdither_rnd = (gdither_rnd * 196314165) + 907633515;
 
-	return rnd * 2.3283064365387e-10f;
+	return gdither_rnd * 2.3283064365387e-10f;
+}
+
+void gdither_noise_seed (uint32_t seed)
+{
+	gdither_rnd = seed;
 }
 
 GDither gdither_new(GDitherType type, uint32_t channels,
@@ -360,8 +370,148 @@ void gdither_run(GDither s, uint32_t channel, uint32_t length,
     }
 }
 
+/* Block-wise version of gdither_innner_loop() for the common
+ * None/Rect/Tri cases with 16 or 32 bit signed output.
+ *
+ * The strided input is gathered, scaled and dithered into a contiguous
+ * buffer (the noise generator is inherently sequential), clamped in the
+ * float domain and then rounded/converted in bulk, so that the expensive
+ * part maps onto SIMD float->int conversion.
+ *
+ * The result is bit-identical to gdither_innner_loop(): clamping to
+ * integral bounds before rounding is equivalent to clamping after
+ * rounding, and cvtps2dq uses the same MXCSR rounding mode as lrintf().
+ */
+static void gdither_block_loop(GDither s, uint32_t channel, uint32_t length,
+                               float const *x, void *y)
+{
+    float   buf[GDITHER_CONV_BLOCK];
+    int32_t ibuf[GDITHER_CONV_BLOCK];
+
+    const uint32_t stride = s->channels;
+    const float scale = s->scale;
+    const float bias = s->bias;
+    const float clamp_u = (float) s->clamp_u;
+    const float clamp_l = (float) s->clamp_l;
+    const int32_t post_scale = (int32_t) s->post_scale;
+    float *ts = s->tri_state;
+
+    int16_t *o16 = (int16_t*) y;
+    int32_t *o32 = (int32_t*) y;
+
+    uint32_t pos = 0;
+
+    while (pos < length) {
+	const uint32_t n = (length - pos) < GDITHER_CONV_BLOCK ? (length - pos) : GDITHER_CONV_BLOCK;
+	float const *xi = x + channel + (size_t) pos * stride;
+	uint32_t k;
+
+	if (stride == 1) {
+	    for (k = 0; k < n; ++k) {
+		buf[k] = xi[k] * scale + bias;
+	    }
+	} else {
+	    for (k = 0; k < n; ++k) {
+		buf[k] = xi[(size_t) k * stride] * scale + bias;
+	    }
+	}
+
+	switch (s->type) {
+	case GDitherRect:
+	    for (k = 0; k < n; ++k) {
+		buf[k] -= gdither_noise ();
+	    }
+	    break;
+	case GDitherTri:
+	    {
+		float t = ts[channel];
+		for (k = 0; k < n; ++k) {
+		    const float r = gdither_noise () - 0.5f;
+		    buf[k] -= r - t;
+		    t = r;
+		}
+		ts[channel] = t;
+	    }
+	    break;
+	default:
+	    break;
+	}
+
+	k = 0;
+#if defined(__SSE2__)
+	{
+	    const __m128 hi = _mm_set1_ps (clamp_u);
+	    const __m128 lo = _mm_set1_ps (clamp_l);
+	    for (; k + 4 <= n; k += 4) {
+		/* max (v, lo) returns lo for NaN, matching lrintf() + clamp */
+		__m128 v = _mm_loadu_ps (&buf[k]);
+		v = _mm_min_ps (_mm_max_ps (v, lo), hi);
+		_mm_storeu_si128 ((__m128i*) &ibuf[k], _mm_cvtps_epi32 (v));
+	    }
+	}
+#endif
+	for (; k < n; ++k) {
+	    float v = buf[k];
+	    if (!(v >= clamp_l)) {
+		v = clamp_l;
+	    } else if (v > clamp_u) {
+		v = clamp_u;
+	    }
+	    ibuf[k] = (int32_t) lrintf (v);
+	}
+
+	if (post_scale != 1) {
+	    for (k = 0; k < n; ++k) {
+		ibuf[k] *= post_scale;
+	    }
+	}
+
+	if (s->bit_depth == GDither16bit) {
+	    int16_t *o = o16 + channel + (size_t) pos * stride;
+	    if (stride == 1) {
+		for (k = 0; k < n; ++k) {
+		    o[k] = (int16_t) ibuf[k];
+		}
+	    } else {
+		for (k = 0; k < n; ++k) {
+		    o[(size_t) k * stride] = (int16_t) ibuf[k];
+		}
+	    }
+	} else {
+	    int32_t *o = o32 + channel + (size_t) pos * stride;
+	    if (stride == 1) {
+		for (k = 0; k < n; ++k) {
+		    o[k] = ibuf[k];
+		}
+	    } else {
+		for (k = 0; k < n; ++k) {
+		    o[(size_t) k * stride] = ibuf[k];
+		}
+	    }
+	}
+
+	pos += n;
+    }
+}
+
 void gdither_runf(GDither s, uint32_t channel, uint32_t length,
                  float const *x, void *y)
+{
+    if (!s || channel >= s->channels) {
+	return;
+    }
+
+    if ((s->bit_depth == GDither16bit || s->bit_depth == GDither32bit)
+        && (s->type == GDitherNone || s->type == GDitherRect || s->type == GDitherTri)) {
+	gdither_block_loop (s, channel, length, x, y);
+	return;
+    }
+
+    gdither_runf_scalar (s, channel, length, x, y);
+}
+
+void gdither_runf_scalar(GDither s, uint32_t channel, uint32_t length,
+                         float const *x, void *y)
 {
     uint32_t pos, i;
     float tmp;
@@ -81,6 +81,18 @@ void gdither_free(GDither s);
 void gdither_runf(GDither s, uint32_t channel, uint32_t length,
 		   float const *x, void *y);
 
+/* Same as gdither_runf, but always uses the per-sample reference
+ * implementation. gdither_runf uses a block-wise (SIMD) path for common
+ * cases, which produces bit-identical output.
+ */
+void gdither_runf_scalar(GDither s, uint32_t channel, uint32_t length,
+		   float const *x, void *y);
+
+/* Reset the state of the (global) noise generator used for dithering,
+ * mainly useful to get reproducible output for testing.
+ */
+void gdither_noise_seed(uint32_t seed);
+
 /* see gdither_runf, vut input argument is double format */
 void gdither_run(GDither s, uint32_t channel, uint32_t length,
 		   double const *x, void *y);
@@ -1,6 +1,7 @@
 #include "tests/utils.h"
 
 #include "audiographer/general/sample_format_converter.h"
+#include "private/gdither/gdither.h"
 
 using namespace AudioGrapher;
 
@@ -15,6 +16,7 @@ class SampleFormatConverterTest : public CppUnit::TestFixture
   CPPUNIT_TEST (testInt16);
   CPPUNIT_TEST (testUint8);
   CPPUNIT_TEST (testChannelCount);
+  CPPUNIT_TEST (testBlockConversionBitExact);
   CPPUNIT_TEST_SUITE_END ();
 
   public:
@@ -204,8 +206,57 @@ class SampleFormatConverterTest : public CppUnit::TestFixture
 		CPPUNIT_ASSERT (TestUtils::array_filled(sink->get_array(), pc.samples()));
 	}
 
+	void testBlockConversionBitExact()
+	{
+		/* compare the block-wise (SIMD) conversion in gdither_runf()
+		 * with the per-sample reference implementation */
+		GDitherType const types[] = { GDitherNone, GDitherRect, GDitherTri };
+		samplecnt_t const length = 1500; // > 2 internal blocks, not a multiple of 4
+
+		for (unsigned int t = 0; t < 3; ++t) {
+			for (uint32_t channels = 1; channels <= 8; channels *= 2) {
+				check_bit_exact<int16_t> (types[t], GDither16bit, 16, channels, length);
+				check_bit_exact<int16_t> (types[t], GDither16bit, 12, channels, length);
+				check_bit_exact<int32_t> (types[t], GDither32bit, 24, channels, length);
+				check_bit_exact<int32_t> (types[t], GDither32bit, 16, channels, length);
+			}
+		}
+	}
+
   private:
 
+	template<typename T>
+	void check_bit_exact (GDitherType type, GDitherSize size, int depth, uint32_t channels, samplecnt_t length)
+	{
+		samplecnt_t const n = length * channels;
+		std::vector<float> in (n);
+		/* include out-of-range values to exercise clamping */
+		for (samplecnt_t i = 0; i < n; ++i) {
+			in[i] = 1.5f * random_data[i % samples] + ((i % 7) ? 0.f : 0.6f);
+		}
+
+		std::vector<T> fast (n);
+		std::vector<T> ref (n);
+
+		GDither d_fast = gdither_new (type, channels, size, depth);
+		GDither d_ref  = gdither_new (type, channels, size, depth);
+
+		gdither_noise_seed (1234);
+		for (uint32_t c = 0; c < channels; ++c) {
+			gdither_runf (d_fast, c, length, &in[0], &fast[0]);
+		}
+
+		gdither_noise_seed (1234);
+		for (uint32_t c = 0; c < channels; ++c) {
+			gdither_runf_scalar (d_ref, c, length, &in[0], &ref[0]);
+		}
+
+		gdither_free (d_fast);
+		gdither_free (d_ref);
+
+		CPPUNIT_ASSERT (TestUtils::array_equals (&fast[0], &ref[0], n));
+	}
+
 	float * random_data;
 	samplecnt_t samples;
 };
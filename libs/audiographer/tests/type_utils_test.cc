@@ -12,6 +12,7 @@ class TypeUtilsTest : public CppUnit::TestFixture
   CPPUNIT_TEST (testCopy);
   CPPUNIT_TEST (testMoveBackward);
   CPPUNIT_TEST (testMoveForward);
+  CPPUNIT_TEST (testInterleaveRoundTrip);
   CPPUNIT_TEST_SUITE_END ();
 
   public:
@@ -98,6 +99,36 @@ class TypeUtilsTest : public CppUnit::TestFixture
 		}
 	}
 
+	void testInterleaveRoundTrip()
+	{
+		samplecnt_t const samples = 37;
+
+		for (unsigned int channels = 1; channels <= 64; ++channels) {
+			std::vector<int> interleaved (samples * channels, -1);
+			std::vector<int> channel_data (samples);
+
+			for (unsigned int c = 0; c < channels; ++c) {
+				for (samplecnt_t i = 0; i < samples; ++i) {
+					channel_data[i] = c * 1000 + i;
+				}
+				TypeUtils<int>::interleave_channel (&channel_data[0], &interleaved[0], c, channels, samples);
+			}
+
+			for (samplecnt_t i = 0; i < samples; ++i) {
+				for (unsigned int c = 0; c < channels; ++c) {
+					CPPUNIT_ASSERT_EQUAL ((int) (c * 1000 + i), interleaved[i * channels + c]);
+				}
+			}
+
+			for (unsigned int c = 0; c < channels; ++c) {
+				TypeUtils<int>::deinterleave_channel (&interleaved[0], &channel_data[0], c, channels, samples);
+				for (samplecnt_t i = 0; i < samples; ++i) {
+					CPPUNIT_ASSERT_EQUAL ((int) (c * 1000 + i), channel_data[i]);
+				}
+			}
+		}
+	}
+
   private:
 
 	struct NonPodType {
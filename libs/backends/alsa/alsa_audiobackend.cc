@@ -37,6 +37,7 @@
 
 #include "ardour/filesystem_paths.h"
 #include "ardour/port_manager.h"
+#include "ardour/runtime_functions.h"
 #include "ardouralsautil/devicelist.h"
 #include "pbd/i18n.h"
 
@@ -75,6 +76,7 @@ AlsaAudioBackend::AlsaAudioBackend (AudioEngine& e, AudioBackendInfo& info)
 	, _midi_device_thread_active (false)
 	, _dsp_load (0)
 	, _processed_samples (0)
+	, _cycle_count (0)
 	, _port_change_flag (false)
 {
 	_instance_name = s_instance_name;
@@ -2222,6 +2224,7 @@ AlsaAudioBackend::main_process_thread ()
 
 				/* call engine process callback */
 				_last_process_start = g_get_monotonic_time();
+				++_cycle_count;
 				if (engine.process_callback (_samples_per_period)) {
 					_pcmi->pcm_stop ();
 					_active = false;
@@ -2316,6 +2319,7 @@ AlsaAudioBackend::main_process_thread ()
 			pthread_mutex_unlock (&_device_port_mutex);
 
 			_last_process_start = 0;
+			++_cycle_count;
 			if (engine.process_callback (_samples_per_period)) {
 				_pcmi->pcm_stop ();
 				_active = false;
@@ -2607,6 +2611,7 @@ int AlsaPort::connect (AlsaPort *port)
 void AlsaPort::_connect (AlsaPort *port, bool callback)
 {
 	_connections.insert (port);
+	connections_changed ();
 	if (callback) {
 		port->_connect (this, false);
 		_alsa_backend.port_connect_callback (name(),  port->name(), true);
@@ -2635,6 +2640,7 @@ void AlsaPort::_disconnect (AlsaPort *port, bool callback)
 	std::set<AlsaPort*>::iterator it = _connections.find (port);
 	assert (it != _connections.end ());
 	_connections.erase (it);
+	connections_changed ();
 	if (callback) {
 		port->_disconnect (this, false);
 		_alsa_backend.port_connect_callback (name(),  port->name(), false);
@@ -2650,6 +2656,13 @@ void AlsaPort::disconnect_all ()
 		_alsa_backend.port_connect_callback (name(), (*it)->name(), false);
 		_connections.erase (it);
 	}
+	connections_changed ();
+}
+
+uint32_t
+AlsaPort::cycle_count () const
+{
+	return _alsa_backend._cycle_count;
 }
 
 bool
@@ -2702,6 +2715,11 @@ AlsaPort::update_connected_latency (bool for_playback)
 
 AlsaAudioPort::AlsaAudioPort (AlsaAudioBackend &b, const std::string& name, PortFlags flags)
 	: AlsaPort (b, name, flags)
+	, _sources (boost::shared_ptr<AudioPortList> (new AudioPortList))
+	, _write_count (0)
+	, _sum_cycle (0)
+	, _sum_writes (0)
+	, _sum_samples (0)
 {
 	memset (_buffer, 0, sizeof (_buffer));
 	mlock(_buffer, sizeof (_buffer));
@@ -2712,28 +2730,62 @@ AlsaAudioPort::~AlsaAudioPort () { }
 void* AlsaAudioPort::get_buffer (pframes_t n_samples)
 {
 	if (is_input ()) {
-		const std::set<AlsaPort *>& connections = get_connections ();
-		std::set<AlsaPort*>::const_iterator it = connections.begin ();
-		if (it == connections.end ()) {
+		boost::shared_ptr<AudioPortList> sources = _sources.reader ();
+
+		/* only sum once per cycle, unless a source was written to
+		 * since (e.g. when the engine splits the cycle)
+		 */
+		uint64_t writes = 0;
+		for (AudioPortList::const_iterator it = sources->begin (); it != sources->end (); ++it) {
+			writes += (*it)->write_count ();
+		}
+
+		if (_sum_samples == n_samples && _sum_cycle == cycle_count () && _sum_writes == writes) {
+			return _buffer;
+		}
+
+		AudioPortList::const_iterator it = sources->begin ();
+		if (it == sources->end ()) {
 			memset (_buffer, 0, n_samples * sizeof (Sample));
 		} else {
-			AlsaAudioPort const * source = static_cast<const AlsaAudioPort*>(*it);
-			assert (source && source->is_output ());
-			memcpy (_buffer, source->const_buffer (), n_samples * sizeof (Sample));
-			while (++it != connections.end ()) {
-				source = static_cast<const AlsaAudioPort*>(*it);
-				assert (source && source->is_output ());
-				Sample* dst = buffer ();
-				const Sample* src = source->const_buffer ();
-				for (uint32_t s = 0; s < n_samples; ++s, ++dst, ++src) {
-					*dst += *src;
-				}
+			copy_vector (_buffer, (*it)->const_buffer (), n_samples);
+			while (++it != sources->end ()) {
+				mix_buffers_no_gain (_buffer, (*it)->const_buffer (), n_samples);
 			}
 		}
+
+		_sum_cycle   = cycle_count ();
+		_sum_writes  = writes;
+		_sum_samples = n_samples;
+	} else {
+		g_atomic_int_inc (&_write_count);
 	}
 	return _buffer;
 }
 
+void
+AlsaAudioPort::connections_changed ()
+{
+	if (!is_input ()) {
+		return;
+	}
+
+	{
+		RCUWriter<AudioPortList> writer (_sources);
+		boost::shared_ptr<AudioPortList> sources = writer.get_copy ();
+		sources->clear ();
+
+		const std::set<AlsaPort*>& connections = get_connections ();
+		for (std::set<AlsaPort*>::const_iterator it = connections.begin (); it != connections.end (); ++it) {
+			assert ((*it)->is_output ());
+			sources->push_back (static_cast<AlsaAudioPort const*> (*it));
+		}
+	}
+
+	/* force summing the new set of sources */
+	_sum_samples = 0;
+}
+
 
 AlsaMidiPort::AlsaMidiPort (AlsaAudioBackend &b, const std::string& name, PortFlags flags)
 	: AlsaPort (b, name, flags)
@@ -34,6 +34,7 @@
 #include "pbd/pthread_utils.h"
 #include "ardour/filesystem_paths.h"
 #include "ardour/port_manager.h"
+#include "ardour/runtime_functions.h"
 #include "pbd/i18n.h"
 
 using namespace ARDOUR;
@@ -106,6 +107,7 @@ CoreAudioBackend::CoreAudioBackend (AudioEngine& e, AudioBackendInfo& info)
 	, _systemic_audio_output_latency (0)
 	, _dsp_load (0)
 	, _processed_samples (0)
+	, _cycle_count (0)
 	, _port_change_flag (false)
 {
 	_instance_name = s_instance_name;
@@ -1757,6 +1759,7 @@ CoreAudioBackend::freewheel_thread ()
 		}
 
 		_last_process_start = 0;
+		++_cycle_count;
 		if (engine.process_callback (_samples_per_period)) {
 			pthread_mutex_unlock (&_process_callback_mutex);
 			break;
@@ -1857,6 +1860,7 @@ CoreAudioBackend::process_callback (const uint32_t n_samples, const uint64_t hos
 	_midiio->start_cycle();
 	_last_process_start = host_time;
 
+	++_cycle_count;
 	if (engine.process_callback (n_samples)) {
 		fprintf(stderr, "ENGINE PROCESS ERROR\n");
 		//_pcmio->pcm_stop ();
@@ -2070,6 +2074,7 @@ int CoreBackendPort::connect (CoreBackendPort *port)
 void CoreBackendPort::_connect (CoreBackendPort *port, bool callback)
 {
 	_connections.insert (port);
+	connections_changed ();
 	if (callback) {
 		port->_connect (this, false);
 		_osx_backend.port_connect_callback (name(),  port->name(), true);
@@ -2098,6 +2103,7 @@ void CoreBackendPort::_disconnect (CoreBackendPort *port, bool callback)
 	std::set<CoreBackendPort*>::iterator it = _connections.find (port);
 	assert (it != _connections.end ());
 	_connections.erase (it);
+	connections_changed ();
 	if (callback) {
 		port->_disconnect (this, false);
 		_osx_backend.port_connect_callback (name(),  port->name(), false);
@@ -2112,6 +2118,13 @@ void CoreBackendPort::disconnect_all ()
 		_osx_backend.port_connect_callback (name(), (*it)->name(), false);
 		_connections.erase (it);
 	}
+	connections_changed ();
+}
+
+uint32_t
+CoreBackendPort::cycle_count () const
+{
+	return _osx_backend._cycle_count;
 }
 
 bool
@@ -2165,6 +2178,11 @@ CoreBackendPort::update_connected_latency (bool for_playback)
 
 CoreAudioPort::CoreAudioPort (CoreAudioBackend &b, const std::string& name, PortFlags flags)
 	: CoreBackendPort (b, name, flags)
+	, _sources (boost::shared_ptr<AudioPortList> (new AudioPortList))
+	, _write_count (0)
+	, _sum_cycle (0)
+	, _sum_writes (0)
+	, _sum_samples (0)
 {
 	memset (_buffer, 0, sizeof (_buffer));
 	mlock(_buffer, sizeof (_buffer));
@@ -2175,28 +2193,62 @@ CoreAudioPort::~CoreAudioPort () { }
 void* CoreAudioPort::get_buffer (pframes_t n_samples)
 {
 	if (is_input ()) {
-		const std::set<CoreBackendPort *>& connections = get_connections ();
-		std::set<CoreBackendPort*>::const_iterator it = connections.begin ();
-		if (it == connections.end ()) {
+		boost::shared_ptr<AudioPortList> sources = _sources.reader ();
+
+		/* only sum once per cycle, unless a source was written to
+		 * since (e.g. when the engine splits the cycle)
+		 */
+		uint64_t writes = 0;
+		for (AudioPortList::const_iterator it = sources->begin (); it != sources->end (); ++it) {
+			writes += (*it)->write_count ();
+		}
+
+		if (_sum_samples == n_samples && _sum_cycle == cycle_count () && _sum_writes == writes) {
+			return _buffer;
+		}
+
+		AudioPortList::const_iterator it = sources->begin ();
+		if (it == sources->end ()) {
 			memset (_buffer, 0, n_samples * sizeof (Sample));
 		} else {
-			CoreAudioPort const * source = static_cast<const CoreAudioPort*>(*it);
-			assert (source && source->is_output ());
-			memcpy (_buffer, source->const_buffer (), n_samples * sizeof (Sample));
-			while (++it != connections.end ()) {
-				source = static_cast<const CoreAudioPort*>(*it);
-				assert (source && source->is_output ());
-				Sample* dst = buffer ();
-				const Sample* src = source->const_buffer ();
-				for (uint32_t s = 0; s < n_samples; ++s, ++dst, ++src) {
-					*dst += *src;
-				}
+			copy_vector (_buffer, (*it)->const_buffer (), n_samples);
+			while (++it != sources->end ()) {
+				mix_buffers_no_gain (_buffer, (*it)->const_buffer (), n_samples);
 			}
 		}
+
+		_sum_cycle   = cycle_count ();
+		_sum_writes  = writes;
+		_sum_samples = n_samples;
+	} else {
+		g_atomic_int_inc (&_write_count);
 	}
 	return _buffer;
 }
 
+void
+CoreAudioPort::connections_changed ()
+{
+	if (!is_input ()) {
+		return;
+	}
+
+	{
+		RCUWriter<AudioPortList> writer (_sources);
+		boost::shared_ptr<AudioPortList> sources = writer.get_copy ();
+		sources->clear ();
+
+		const std::set<CoreBackendPort*>& connections = get_connections ();
+		for (std::set<CoreBackendPort*>::const_iterator it = connections.begin (); it != connections.end (); ++it) {
+			assert ((*it)->is_output ());
+			sources->push_back (static_cast<CoreAudioPort const*> (*it));
+		}
+	}
+
+	/* force summing the new set of sources */
+	_sum_samples = 0;
+}
+
 
 CoreMidiPort::CoreMidiPort (CoreAudioBackend &b, const std::string& name, PortFlags flags)
 	: CoreBackendPort (b, name, flags)
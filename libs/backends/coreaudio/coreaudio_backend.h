@@ -31,6 +31,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include "pbd/natsort.h"
+#include "pbd/rcu.h"
 #include "ardour/audio_backend.h"
 #include "ardour/dsp_load_calculator.h"
 #include "ardour/types.h"
@@ -100,6 +101,11 @@ class CoreBackendPort {
 
 	void update_connected_latency (bool for_playback);
 
+  protected:
+	/** called when connections change, not realtime safe */
+	virtual void connections_changed () {}
+	uint32_t cycle_count () const;
+
   private:
 	CoreAudioBackend &_osx_backend;
 	std::string _name;
@@ -125,8 +131,27 @@ class CoreAudioPort : public CoreBackendPort {
 	const Sample* const_buffer () const { return _buffer; }
 	void* get_buffer (pframes_t nframes);
 
+	uint32_t write_count () const { return g_atomic_int_get (const_cast<gint*>(&_write_count)); }
+
+  protected:
+	void connections_changed ();
+
   private:
 	Sample _buffer[8192];
+
+	/* output ports connected to this input */
+	typedef std::vector<CoreAudioPort const*> AudioPortList;
+	SerializedRCUManager<AudioPortList> _sources;
+
+	/* outputs: incremented whenever the buffer is handed out for writing.
+	 * written by the process thread that owns the port, read by whichever
+	 * thread sums a connected input. */
+	volatile gint _write_count;
+
+	/* inputs: state of the sources when _buffer was summed */
+	uint32_t  _sum_cycle;
+	uint64_t  _sum_writes;
+	pframes_t _sum_samples;
 }; // class CoreAudioPort
 
 class CoreMidiPort : public CoreBackendPort {
@@ -436,6 +461,7 @@ class CoreAudioBackend : public AudioBackend {
 	float  _dsp_load;
 	ARDOUR::DSPLoadCalculator  _dsp_load_calc;
 	uint64_t _processed_samples;
+	uint32_t _cycle_count;
 
 	pthread_t _main_thread;
 	pthread_t _freeewheel_thread;
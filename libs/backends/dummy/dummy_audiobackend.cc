@@ -22,8 +22,13 @@
 #include <math.h>
 #include <sys/time.h>
 #include <regex.h>
+#include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
 #include <glibmm.h>
 
 #ifdef PLATFORM_WINDOWS
@@ -36,7 +41,9 @@
 
 #include "pbd/error.h"
 #include "pbd/compose.h"
+#include "ardour/audioengine.h"
 #include "ardour/port_manager.h"
+#include "ardour/runtime_functions.h"
 #include "pbd/i18n.h"
 
 using namespace ARDOUR;
@@ -73,6 +80,12 @@ DummyAudioBackend::DummyAudioBackend (AudioEngine& e, AudioBackendInfo& info)
 	, _systemic_input_latency (0)
 	, _systemic_output_latency (0)
 	, _processed_samples (0)
+	, _cycle_count (0)
+	, _benchmark_state (BenchmarkIdle)
+	, _benchmark_length (0)
+	, _benchmark_nominal (0)
+	, _benchmark_thread_active (false)
+	, _benchmark_sem ("dummy_benchmark", 0)
 	, _port_change_flag (false)
 {
 	_instance_name = s_instance_name;
@@ -88,6 +101,7 @@ DummyAudioBackend::DummyAudioBackend (AudioEngine& e, AudioBackendInfo& info)
 		_driver_speed.push_back (DriverSpeed (_("15x Speed"),    0.06666f));
 		_driver_speed.push_back (DriverSpeed (_("20x Speed"),    0.05f));
 		_driver_speed.push_back (DriverSpeed (_("50x Speed"),    0.02f));
+		_driver_speed.push_back (DriverSpeed (_("Benchmark"),    0.0f));
 	}
 
 }
@@ -474,6 +488,19 @@ DummyAudioBackend::_start (bool /*for_latency_measurement*/)
 	engine.reconnect_ports ();
 	_port_change_flag = false;
 
+	_benchmark_state = BenchmarkIdle;
+	if (benchmark_mode ()) {
+		/* measure this many cycles once a session is loaded */
+		const char* cycles = g_getenv ("ARDOUR_DUMMY_BENCHMARK_CYCLES");
+		const char* report = g_getenv ("ARDOUR_DUMMY_BENCHMARK_REPORT");
+		_benchmark_length = cycles ? std::max (1, atoi (cycles)) : 10000;
+		_benchmark_report_path = report ? report : "";
+		_benchmark_cycles.clear ();
+		_benchmark_cycles.reserve (_benchmark_length);
+		_benchmark_sem.reset ();
+		_benchmark_state = BenchmarkWaiting;
+	}
+
 	if (pthread_create (&_main_thread, NULL, pthread_process, this)) {
 		PBD::error << _("DummyAudioBackend: cannot start.") << endmsg;
 	}
@@ -486,6 +513,15 @@ DummyAudioBackend::_start (bool /*for_latency_measurement*/)
 		return ProcessThreadStartError;
 	}
 
+	if (_benchmark_state == BenchmarkWaiting) {
+		if (pthread_create (&_benchmark_thread, NULL, benchmark_thread, this)) {
+			PBD::error << _("DummyAudioBackend: cannot start benchmark report thread.") << endmsg;
+		} else {
+			_benchmark_thread_active = true;
+			PBD::info << string_compose (_("DummyAudioBackend: benchmarking %1 cycles once a session is loaded."), _benchmark_length) << endmsg;
+		}
+	}
+
 	return NoError;
 }
 
@@ -502,6 +538,20 @@ DummyAudioBackend::stop ()
 		PBD::error << _("DummyAudioBackend: failed to terminate.") << endmsg;
 		return -1;
 	}
+
+	if (_benchmark_thread_active) {
+		if (_benchmark_state != BenchmarkDone) {
+			/* incomplete run, wake up the report thread without a report */
+			if (_benchmark_state == BenchmarkRunning) {
+				engine.stop_route_process_stats ();
+			}
+			_benchmark_state = BenchmarkIdle;
+			_benchmark_sem.signal ();
+		}
+		pthread_join (_benchmark_thread, &status);
+		_benchmark_thread_active = false;
+	}
+
 	unregister_ports();
 	return 0;
 }
@@ -1350,6 +1400,12 @@ DummyAudioBackend::main_process_thread ()
 			engine.freewheel_callback (_freewheel);
 		}
 
+		if (_benchmark_state == BenchmarkWaiting && engine.start_route_process_stats ()) {
+			/* session is loaded, start measuring */
+			_benchmark_cycles.clear ();
+			_benchmark_state = BenchmarkRunning;
+		}
+
 		// re-set input buffers, generate on demand.
 		for (std::vector<DummyAudioPort*>::const_iterator it = _system_inputs.begin (); it != _system_inputs.end (); ++it) {
 			(*it)->next_period();
@@ -1358,6 +1414,7 @@ DummyAudioBackend::main_process_thread ()
 			(*it)->next_period();
 		}
 
+		++_cycle_count;
 		if (engine.process_callback (samples_per_period)) {
 			return 0;
 		}
@@ -1399,8 +1456,19 @@ DummyAudioBackend::main_process_thread ()
 
 			const int64_t elapsed_time = _dsp_load_calc.elapsed_time_us ();
 			const int64_t nominal_time = _dsp_load_calc.get_max_time_us ();
-			if (elapsed_time < nominal_time) {
-				const int64_t sleepy = _speedup * (nominal_time - elapsed_time);
+			if (_benchmark_state == BenchmarkRunning) {
+				/* no pacing, run the next cycle right away */
+				_benchmark_cycles.push_back (elapsed_time); // reserved in _start
+				if (_benchmark_cycles.size () >= _benchmark_length) {
+					engine.stop_route_process_stats ();
+					_benchmark_nominal = nominal_time;
+					_benchmark_state = BenchmarkDone;
+					_benchmark_sem.signal ();
+				}
+			} else if (elapsed_time < nominal_time) {
+				/* before and after a benchmark run, use normal speed */
+				const float speedup = benchmark_mode () ? 1.f : _speedup;
+				const int64_t sleepy = speedup * (nominal_time - elapsed_time);
 				Glib::usleep (std::max ((int64_t) 100, sleepy));
 			} else {
 				Glib::usleep (100); // don't hog cpu
@@ -1448,6 +1516,166 @@ DummyAudioBackend::main_process_thread ()
 	return 0;
 }
 
+void*
+DummyAudioBackend::benchmark_thread (void* arg)
+{
+	DummyAudioBackend* d = static_cast<DummyAudioBackend*> (arg);
+	d->_benchmark_sem.wait ();
+	if (d->_benchmark_state == BenchmarkDone) {
+		d->benchmark_report ();
+	}
+	return 0;
+}
+
+static std::string
+json_escape (std::string const& s)
+{
+	std::string rv;
+	for (std::string::const_iterator i = s.begin (); i != s.end (); ++i) {
+		switch (*i) {
+			case '"':  rv += "\\\""; break;
+			case '\\': rv += "\\\\"; break;
+			case '\n': rv += "\\n"; break;
+			case '\t': rv += "\\t"; break;
+			default:
+				if ((unsigned char) *i < 0x20) {
+					char buf[8];
+					snprintf (buf, sizeof (buf), "\\u%04x", (int) *i);
+					rv += buf;
+				} else {
+					rv += *i;
+				}
+				break;
+		}
+	}
+	return rv;
+}
+
+static std::string
+csv_escape (std::string const& s)
+{
+	if (s.find_first_of (",\"\n") == std::string::npos) {
+		return s;
+	}
+	std::string rv ("\"");
+	for (std::string::const_iterator i = s.begin (); i != s.end (); ++i) {
+		if (*i == '"') {
+			rv += '"';
+		}
+		rv += *i;
+	}
+	return rv + "\"";
+}
+
+/** Write benchmark results, as CSV if the report path ends in ".csv",
+ * JSON otherwise. Without ARDOUR_DUMMY_BENCHMARK_REPORT the JSON
+ * report is printed to stdout.
+ *
+ * Cycle times are wall-clock microseconds of each process cycle,
+ * the histogram counts cycles by DSP load in 1% steps, the last
+ * bucket collects all cycles that exceeded the nominal period.
+ *
+ * Runs in the report thread, after the process thread has finished
+ * the benchmark run.
+ */
+void
+DummyAudioBackend::benchmark_report ()
+{
+	const size_t  n_cycles = _benchmark_cycles.size ();
+	const int64_t nominal  = _benchmark_nominal;
+
+	if (n_cycles == 0 || nominal <= 0) {
+		return;
+	}
+
+	std::vector<int64_t> sorted (_benchmark_cycles);
+	std::sort (sorted.begin (), sorted.end ());
+
+	double sum = 0;
+	for (std::vector<int64_t>::const_iterator i = sorted.begin (); i != sorted.end (); ++i) {
+		sum += *i;
+	}
+	const double avg = sum / n_cycles;
+
+	double var = 0;
+	for (std::vector<int64_t>::const_iterator i = sorted.begin (); i != sorted.end (); ++i) {
+		var += (*i - avg) * (*i - avg);
+	}
+	const double dev = n_cycles > 1 ? sqrt (var / (n_cycles - 1)) : 0;
+
+	const int64_t min = sorted.front ();
+	const int64_t max = sorted.back ();
+	const int64_t p50 = sorted[(n_cycles - 1) / 2];
+	const int64_t p99 = sorted[(size_t) ((n_cycles - 1) * .99)];
+
+	/* DSP load histogram, 0..100% and overload */
+	std::vector<uint64_t> histogram (102, 0);
+	for (std::vector<int64_t>::const_iterator i = _benchmark_cycles.begin (); i != _benchmark_cycles.end (); ++i) {
+		histogram[std::min ((int64_t) 101, (*i * 100) / nominal)] += 1;
+	}
+
+	/* realtime factor: audio time processed per wall-clock time */
+	const double speed = (double) nominal * n_cycles / std::max (1.0, sum);
+
+	std::vector<AudioEngine::RouteProcessStats> routes;
+	engine.get_route_process_stats (routes);
+
+	std::ofstream file;
+	const bool to_file = !_benchmark_report_path.empty ();
+	if (to_file) {
+		file.open (_benchmark_report_path.c_str ());
+		if (!file) {
+			PBD::error << string_compose (_("DummyAudioBackend: cannot write benchmark report to %1."), _benchmark_report_path) << endmsg;
+			return;
+		}
+	}
+	std::ostream& o (to_file ? file : std::cout);
+
+	const bool csv = _benchmark_report_path.size () > 4
+		&& _benchmark_report_path.substr (_benchmark_report_path.size () - 4) == ".csv";
+
+	if (csv) {
+		o << "type,name,count,min_us,max_us,avg_us,dev_us,p50_us,p99_us\n";
+		o << "engine,cycle," << n_cycles << "," << min << "," << max << "," << avg << "," << dev << "," << p50 << "," << p99 << "\n";
+		for (std::vector<AudioEngine::RouteProcessStats>::const_iterator i = routes.begin (); i != routes.end (); ++i) {
+			o << "route," << csv_escape (i->name) << ",," << i->min << "," << i->max << "," << i->avg << "," << i->dev << ",,\n";
+		}
+		for (size_t b = 0; b < histogram.size (); ++b) {
+			if (histogram[b] > 0) {
+				o << "histogram," << (b < 101 ? string_compose ("%1", b) : std::string (">100")) << "%," << histogram[b] << ",,,,,,\n";
+			}
+		}
+	} else {
+		o << "{\n"
+		  << "  \"backend\": \"" << json_escape (name ()) << "\",\n"
+		  << "  \"samplerate\": " << _samplerate << ",\n"
+		  << "  \"period\": " << _samples_per_period << ",\n"
+		  << "  \"nominal_us\": " << nominal << ",\n"
+		  << "  \"cycles\": " << n_cycles << ",\n"
+		  << "  \"realtime_factor\": " << speed << ",\n"
+		  << "  \"cycle_us\": { \"min\": " << min << ", \"max\": " << max << ", \"avg\": " << avg << ", \"dev\": " << dev
+		  << ", \"p50\": " << p50 << ", \"p99\": " << p99 << " },\n"
+		  << "  \"jitter_us\": " << (max - min) << ",\n"
+		  << "  \"dsp_load_histogram\": [";
+		for (size_t b = 0; b < histogram.size (); ++b) {
+			o << (b > 0 ? ", " : "") << histogram[b];
+		}
+		o << "],\n"
+		  << "  \"routes\": [";
+		for (std::vector<AudioEngine::RouteProcessStats>::const_iterator i = routes.begin (); i != routes.end (); ++i) {
+			o << (i != routes.begin () ? "," : "") << "\n"
+			  << "    { \"name\": \"" << json_escape (i->name) << "\", \"min_us\": " << i->min << ", \"max_us\": " << i->max
+			  << ", \"avg_us\": " << i->avg << ", \"dev_us\": " << i->dev << " }";
+		}
+		o << (routes.empty () ? "" : "\n  ") << "]\n"
+		  << "}\n";
+	}
+
+	o.flush ();
+
+	PBD::info << string_compose (_("DummyAudioBackend: benchmark finished, %1 cycles, avg %2 us, max %3 us."), n_cycles, avg, max) << endmsg;
+}
+
 
 /******************************************************************************/
 
@@ -1578,6 +1806,7 @@ int DummyPort::connect (DummyPort *port)
 void DummyPort::_connect (DummyPort *port, bool callback)
 {
 	_connections.insert (port);
+	connections_changed ();
 	if (callback) {
 		port->_connect (this, false);
 		_dummy_backend.port_connect_callback (name(),  port->name(), true);
@@ -1606,6 +1835,7 @@ void DummyPort::_disconnect (DummyPort *port, bool callback)
 	std::set<DummyPort*>::iterator it = _connections.find (port);
 	assert (it != _connections.end ());
 	_connections.erase (it);
+	connections_changed ();
 	if (callback) {
 		port->_disconnect (this, false);
 		_dummy_backend.port_connect_callback (name(),  port->name(), false);
@@ -1621,6 +1851,13 @@ void DummyPort::disconnect_all ()
 		_dummy_backend.port_connect_callback (name(), (*it)->name(), false);
 		_connections.erase (it);
 	}
+	connections_changed ();
+}
+
+uint32_t
+DummyPort::cycle_count () const
+{
+	return _dummy_backend._cycle_count;
 }
 
 bool
@@ -1671,6 +1908,12 @@ DummyPort::update_connected_latency (bool for_playback)
 
 void DummyPort::setup_random_number_generator ()
 {
+	if (_dummy_backend.benchmark_mode ()) {
+		/* reproducible signals */
+		_rseed = g_str_hash (_name.c_str ()) % INT_MAX;
+		if (_rseed == 0) _rseed = 1;
+		return;
+	}
 #ifdef PLATFORM_WINDOWS
 	LARGE_INTEGER Count;
 	if (QueryPerformanceCounter (&Count)) {
@@ -1721,6 +1964,11 @@ DummyPort::pulse_position () const
 
 DummyAudioPort::DummyAudioPort (DummyAudioBackend &b, const std::string& name, PortFlags flags)
 	: DummyPort (b, name, flags)
+	, _sources (boost::shared_ptr<AudioPortList> (new AudioPortList))
+	, _write_count (0)
+	, _sum_cycle (0)
+	, _sum_writes (0)
+	, _sum_samples (0)
 	, _gen_type (Silence)
 	, _b0 (0)
 	, _b1 (0)
@@ -2165,38 +2413,70 @@ void DummyAudioPort::generate (const pframes_t n_samples)
 void* DummyAudioPort::get_buffer (pframes_t n_samples)
 {
 	if (is_input ()) {
-		const std::set<DummyPort *>& connections = get_connections ();
-		std::set<DummyPort*>::const_iterator it = connections.begin ();
-		if (it == connections.end ()) {
+		boost::shared_ptr<AudioPortList> sources = _sources.reader ();
+
+		/* only sum once per cycle, unless a source was written to
+		 * since (e.g. when the engine splits the cycle)
+		 */
+		uint64_t writes = 0;
+		for (AudioPortList::const_iterator it = sources->begin (); it != sources->end (); ++it) {
+			if ((*it)->is_physical() && (*it)->is_terminal()) {
+				(*it)->get_buffer(n_samples); // generate signal.
+			}
+			writes += (*it)->write_count ();
+		}
+
+		if (_sum_samples == n_samples && _sum_cycle == cycle_count () && _sum_writes == writes) {
+			return _buffer;
+		}
+
+		AudioPortList::const_iterator it = sources->begin ();
+		if (it == sources->end ()) {
 			memset (_buffer, 0, n_samples * sizeof (Sample));
 		} else {
-			DummyAudioPort * source = static_cast<DummyAudioPort*>(*it);
-			assert (source && source->is_output ());
-			if (source->is_physical() && source->is_terminal()) {
-				source->get_buffer(n_samples); // generate signal.
-			}
-			memcpy (_buffer, source->const_buffer (), n_samples * sizeof (Sample));
-			while (++it != connections.end ()) {
-				source = static_cast<DummyAudioPort*>(*it);
-				assert (source && source->is_output ());
-				Sample* dst = buffer ();
-				if (source->is_physical() && source->is_terminal()) {
-					source->get_buffer(n_samples); // generate signal.
-				}
-				const Sample* src = source->const_buffer ();
-				for (uint32_t s = 0; s < n_samples; ++s, ++dst, ++src) {
-					*dst += *src;
-				}
+			copy_vector (_buffer, (*it)->const_buffer (), n_samples);
+			while (++it != sources->end ()) {
+				mix_buffers_no_gain (_buffer, (*it)->const_buffer (), n_samples);
 			}
 		}
-	} else if (is_output () && is_physical () && is_terminal()) {
+
+		_sum_cycle   = cycle_count ();
+		_sum_writes  = writes;
+		_sum_samples = n_samples;
+	} else if (is_physical () && is_terminal()) {
 		if (!_gen_cycle) {
 			generate(n_samples);
+			g_atomic_int_inc (&_write_count);
 		}
+	} else {
+		g_atomic_int_inc (&_write_count);
 	}
 	return _buffer;
 }
 
+void
+DummyAudioPort::connections_changed ()
+{
+	if (!is_input ()) {
+		return;
+	}
+
+	{
+		RCUWriter<AudioPortList> writer (_sources);
+		boost::shared_ptr<AudioPortList> sources = writer.get_copy ();
+		sources->clear ();
+
+		const std::set<DummyPort*>& connections = get_connections ();
+		for (std::set<DummyPort*>::const_iterator it = connections.begin (); it != connections.end (); ++it) {
+			assert ((*it)->is_output ());
+			sources->push_back (static_cast<DummyAudioPort*> (*it));
+		}
+	}
+
+	/* force summing the new set of sources */
+	_sum_samples = 0;
+}
+
 
 DummyMidiPort::DummyMidiPort (DummyAudioBackend &b, const std::string& name, PortFlags flags)
 	: DummyPort (b, name, flags)
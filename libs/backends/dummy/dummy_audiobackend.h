@@ -33,7 +33,9 @@
 #include <boost/shared_ptr.hpp>
 
 #include "pbd/natsort.h"
+#include "pbd/rcu.h"
 #include "pbd/ringbuffer.h"
+#include "pbd/semutils.h"
 #include "ardour/types.h"
 #include "ardour/audio_backend.h"
 #include "ardour/dsp_load_calculator.h"
@@ -131,6 +133,10 @@ class DummyPort {
 		/* engine time */
 		pframes_t pulse_position () const;
 
+		/** called when connections change, not realtime safe */
+		virtual void connections_changed () {}
+		uint32_t cycle_count () const;
+
 		// signal generator
 		volatile bool _gen_cycle;
 		Glib::Threads::Mutex generator_lock;
@@ -148,6 +154,8 @@ class DummyAudioPort : public DummyPort {
 		const Sample* const_buffer () const { return _buffer; }
 		void* get_buffer (pframes_t nframes);
 
+		uint32_t write_count () const { return g_atomic_int_get (const_cast<gint*>(&_write_count)); }
+
 		enum GeneratorType {
 			Silence,
 			DC05,
@@ -172,9 +180,26 @@ class DummyAudioPort : public DummyPort {
 		void fill_wavetable (const float* d, size_t n_samples) { assert(_wavetable != 0);  memcpy(_wavetable, d, n_samples * sizeof(float)); }
 		void midi_to_wavetable (DummyMidiBuffer const * const src, size_t n_samples);
 
+	protected:
+		void connections_changed ();
+
 	private:
 		Sample _buffer[8192];
 
+		/* output ports connected to this input */
+		typedef std::vector<DummyAudioPort*> AudioPortList;
+		SerializedRCUManager<AudioPortList> _sources;
+
+		/* outputs: incremented whenever the buffer is handed out for writing.
+		 * written by the process thread that owns the port, read by whichever
+		 * thread sums a connected input. */
+		volatile gint _write_count;
+
+		/* inputs: state of the sources when _buffer was summed */
+		uint32_t  _sum_cycle;
+		uint64_t  _sum_writes;
+		pframes_t _sum_samples;
+
 		// signal generator ('fake' physical inputs)
 		void generate (const pframes_t n_samples);
 		GeneratorType _gen_type;
@@ -388,6 +413,10 @@ class DummyAudioBackend : public AudioBackend {
 
 		static size_t max_buffer_size() {return _max_buffer_size;}
 
+		/** "Benchmark" driver: run cycles back-to-back with deterministic
+		 * generators and report timing statistics, see benchmark_report() */
+		bool benchmark_mode () const { return _speedup == 0; }
+
 	private:
 		enum MidiPortMode {
 			MidiNoEvents,
@@ -432,6 +461,30 @@ class DummyAudioBackend : public AudioBackend {
 		uint32_t _systemic_output_latency;
 
 		samplecnt_t _processed_samples;
+		uint32_t _cycle_count;
+
+		/* benchmark mode */
+		enum BenchmarkState {
+			BenchmarkIdle,
+			BenchmarkWaiting,
+			BenchmarkRunning,
+			BenchmarkDone
+		};
+
+		BenchmarkState       _benchmark_state;
+		size_t               _benchmark_length;
+		int64_t              _benchmark_nominal;
+		std::string          _benchmark_report_path;
+		std::vector<int64_t> _benchmark_cycles;
+
+		/* the report is written by a non-realtime thread,
+		 * woken up by the process thread when it is done */
+		pthread_t      _benchmark_thread;
+		bool           _benchmark_thread_active;
+		PBD::Semaphore _benchmark_sem;
+
+		static void* benchmark_thread (void*);
+		void benchmark_report ();
 
 		pthread_t _main_thread;
 
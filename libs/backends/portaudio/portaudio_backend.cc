@@ -42,6 +42,7 @@
 
 #include "ardour/filesystem_paths.h"
 #include "ardour/port_manager.h"
+#include "ardour/runtime_functions.h"
 #include "pbd/i18n.h"
 
 #include "audio_utils.h"
@@ -87,6 +88,7 @@ PortAudioBackend::PortAudioBackend (AudioEngine& e, AudioBackendInfo& info)
 	, _systemic_audio_output_latency (0)
 	, _dsp_load (0)
 	, _processed_samples (0)
+	, _port_cycle (0)
 	, _port_change_flag (false)
 {
 	_instance_name = s_instance_name;
@@ -1991,6 +1993,7 @@ PortAudioBackend::blocking_process_main(const float* interleaved_input_data,
 	}
 
 	/* call engine process callback */
+	++_port_cycle;
 	if (engine.process_callback(_samples_per_period)) {
 		_pcmio->close_stream();
 		_active = false;
@@ -2044,6 +2047,7 @@ PortAudioBackend::blocking_process_freewheel()
 
 	// TODO clear midi or stop midi recv when entering fwheelin'
 
+	++_port_cycle;
 	if (engine.process_callback(_samples_per_period)) {
 		_pcmio->close_stream();
 		_active = false;
@@ -2282,6 +2286,7 @@ int PamPort::connect (PamPort *port)
 void PamPort::_connect (PamPort *port, bool callback)
 {
 	_connections.push_back (port);
+	connections_changed ();
 	if (callback) {
 		port->_connect (this, false);
 		_osx_backend.port_connect_callback (name(),  port->name(), true);
@@ -2313,6 +2318,7 @@ void PamPort::_disconnect (PamPort *port, bool callback)
 	assert (it != _connections.end ());
 
 	_connections.erase (it);
+	connections_changed ();
 
 	if (callback) {
 		port->_disconnect (this, false);
@@ -2328,6 +2334,13 @@ void PamPort::disconnect_all ()
 		_osx_backend.port_connect_callback (name(),  _connections.back ()->name(), false);
 		_connections.pop_back ();
 	}
+	connections_changed ();
+}
+
+uint32_t
+PamPort::cycle_count () const
+{
+	return _osx_backend._port_cycle;
 }
 
 bool
@@ -2380,6 +2393,11 @@ PamPort::update_connected_latency (bool for_playback)
 
 PortAudioPort::PortAudioPort (PortAudioBackend &b, const std::string& name, PortFlags flags)
 	: PamPort (b, name, flags)
+	, _sources (boost::shared_ptr<AudioPortList> (new AudioPortList))
+	, _write_count (0)
+	, _sum_cycle (0)
+	, _sum_writes (0)
+	, _sum_samples (0)
 {
 	memset (_buffer, 0, sizeof (_buffer));
 #ifndef PLATFORM_WINDOWS
@@ -2392,27 +2410,62 @@ PortAudioPort::~PortAudioPort () { }
 void* PortAudioPort::get_buffer (pframes_t n_samples)
 {
 	if (is_input ()) {
-		std::vector<PamPort*>::const_iterator it = get_connections ().begin ();
-		if (it == get_connections ().end ()) {
+		boost::shared_ptr<AudioPortList> sources = _sources.reader ();
+
+		/* only sum once per cycle, unless a source was written to
+		 * since (e.g. when the engine splits the cycle)
+		 */
+		uint64_t writes = 0;
+		for (AudioPortList::const_iterator it = sources->begin (); it != sources->end (); ++it) {
+			writes += (*it)->write_count ();
+		}
+
+		if (_sum_samples == n_samples && _sum_cycle == cycle_count () && _sum_writes == writes) {
+			return _buffer;
+		}
+
+		AudioPortList::const_iterator it = sources->begin ();
+		if (it == sources->end ()) {
 			memset (_buffer, 0, n_samples * sizeof (Sample));
 		} else {
-			PortAudioPort const * source = static_cast<const PortAudioPort*>(*it);
-			assert (source && source->is_output ());
-			memcpy (_buffer, source->const_buffer (), n_samples * sizeof (Sample));
-			while (++it != get_connections ().end ()) {
-				source = static_cast<const PortAudioPort*>(*it);
-				assert (source && source->is_output ());
-				Sample* dst = buffer ();
-				const Sample* src = source->const_buffer ();
-				for (uint32_t s = 0; s < n_samples; ++s, ++dst, ++src) {
-					*dst += *src;
-				}
+			copy_vector (_buffer, (*it)->const_buffer (), n_samples);
+			while (++it != sources->end ()) {
+				mix_buffers_no_gain (_buffer, (*it)->const_buffer (), n_samples);
 			}
 		}
+
+		_sum_cycle   = cycle_count ();
+		_sum_writes  = writes;
+		_sum_samples = n_samples;
+	} else {
+		g_atomic_int_inc (&_write_count);
 	}
 	return _buffer;
 }
 
+void
+PortAudioPort::connections_changed ()
+{
+	if (!is_input ()) {
+		return;
+	}
+
+	{
+		RCUWriter<AudioPortList> writer (_sources);
+		boost::shared_ptr<AudioPortList> sources = writer.get_copy ();
+		sources->clear ();
+
+		const std::vector<PamPort*>& connections = get_connections ();
+		for (std::vector<PamPort*>::const_iterator it = connections.begin (); it != connections.end (); ++it) {
+			assert ((*it)->is_output ());
+			sources->push_back (static_cast<PortAudioPort const*> (*it));
+		}
+	}
+
+	/* force summing the new set of sources */
+	_sum_samples = 0;
+}
+
 
 PortMidiPort::PortMidiPort (PortAudioBackend &b, const std::string& name, PortFlags flags)
 	: PamPort (b, name, flags)
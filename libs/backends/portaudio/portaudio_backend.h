@@ -30,6 +30,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include "pbd/rcu.h"
+
 #include "ardour/audio_backend.h"
 #include "ardour/dsp_load_calculator.h"
 #include "ardour/types.h"
@@ -98,6 +100,11 @@ class PamPort { // PortAudio / PortMidi Backend Port
 
 		void update_connected_latency (bool for_playback);
 
+	protected:
+		/** called when connections change, not realtime safe */
+		virtual void connections_changed () {}
+		uint32_t cycle_count () const;
+
 	private:
 		PortAudioBackend &_osx_backend;
 		std::string _name;
@@ -123,8 +130,27 @@ class PortAudioPort : public PamPort {
 		const Sample* const_buffer () const { return _buffer; }
 		void* get_buffer (pframes_t nframes);
 
+		uint32_t write_count () const { return g_atomic_int_get (const_cast<gint*>(&_write_count)); }
+
+	protected:
+		void connections_changed ();
+
 	private:
 		Sample _buffer[8192];
+
+		/* output ports connected to this input */
+		typedef std::vector<PortAudioPort const*> AudioPortList;
+		SerializedRCUManager<AudioPortList> _sources;
+
+		/* outputs: incremented whenever the buffer is handed out for writing.
+		 * written by the process thread that owns the port, read by whichever
+		 * thread sums a connected input. */
+		volatile gint _write_count;
+
+		/* inputs: state of the sources when _buffer was summed */
+		uint32_t  _sum_cycle;
+		uint64_t  _sum_writes;
+		pframes_t _sum_samples;
 }; // class PortAudioPort
 
 class PortMidiPort : public PamPort {
@@ -401,6 +427,7 @@ class PortAudioBackend : public AudioBackend {
 		/* processing */
 		float  _dsp_load;
 		samplecnt_t _processed_samples;
+		uint32_t _port_cycle; ///< incremented once per process callback, see PamPort::cycle_count()
 
 		/* blocking thread */
 		pthread_t _main_blocking_thread;
@@ -32,6 +32,7 @@
 #include "pbd/pthread_utils.h"
 
 #include "ardour/port_manager.h"
+#include "ardour/runtime_functions.h"
 
 #include "pulseaudio_backend.h"
 
@@ -60,6 +61,7 @@ PulseAudioBackend::PulseAudioBackend (AudioEngine& e, AudioBackendInfo& info)
 	, _systemic_audio_output_latency (0)
 	, _dsp_load (0)
 	, _processed_samples (0)
+	, _cycle_count (0)
 	, _port_change_flag (false)
 {
 	_instance_name = s_instance_name;
@@ -1458,6 +1460,7 @@ PulseAudioBackend::main_process_thread ()
 			int64_t clock1 = g_get_monotonic_time ();
 			/* call engine process callback */
 			_last_process_start = g_get_monotonic_time ();
+			++_cycle_count;
 			if (engine.process_callback (_samples_per_period)) {
 				pa_threaded_mainloop_unlock (p_mainloop);
 				_active = false;
@@ -1492,6 +1495,7 @@ PulseAudioBackend::main_process_thread ()
 		} else {
 			/* Freewheelin' */
 			_last_process_start = 0;
+			++_cycle_count;
 			if (engine.process_callback (_samples_per_period)) {
 				_active = false;
 				return 0;
@@ -1658,6 +1662,7 @@ void
 PulsePort::_connect (PulsePort* port, bool callback)
 {
 	_connections.insert (port);
+	connections_changed ();
 	if (callback) {
 		port->_connect (this, false);
 		_pulse_backend.port_connect_callback (name (), port->name (), true);
@@ -1688,6 +1693,7 @@ PulsePort::_disconnect (PulsePort* port, bool callback)
 	std::set<PulsePort*>::iterator it = _connections.find (port);
 	assert (it != _connections.end ());
 	_connections.erase (it);
+	connections_changed ();
 	if (callback) {
 		port->_disconnect (this, false);
 		_pulse_backend.port_connect_callback (name (), port->name (), false);
@@ -1703,6 +1709,13 @@ PulsePort::disconnect_all ()
 		_pulse_backend.port_connect_callback (name (), (*it)->name (), false);
 		_connections.erase (it);
 	}
+	connections_changed ();
+}
+
+uint32_t
+PulsePort::cycle_count () const
+{
+	return _pulse_backend._cycle_count;
 }
 
 bool
@@ -1756,6 +1769,11 @@ PulsePort::update_connected_latency (bool for_playback)
 
 PulseAudioPort::PulseAudioPort (PulseAudioBackend& b, const std::string& name, PortFlags flags)
     : PulsePort (b, name, flags)
+    , _sources (boost::shared_ptr<AudioPortList> (new AudioPortList))
+    , _write_count (0)
+    , _sum_cycle (0)
+    , _sum_writes (0)
+    , _sum_samples (0)
 {
 	memset (_buffer, 0, sizeof (_buffer));
 	mlock (_buffer, sizeof (_buffer));
@@ -1769,28 +1787,62 @@ void*
 PulseAudioPort::get_buffer (pframes_t n_samples)
 {
 	if (is_input ()) {
-		const std::set<PulsePort*>&          connections = get_connections ();
-		std::set<PulsePort*>::const_iterator it          = connections.begin ();
-		if (it == connections.end ()) {
+		boost::shared_ptr<AudioPortList> sources = _sources.reader ();
+
+		/* only sum once per cycle, unless a source was written to
+		 * since (e.g. when the engine splits the cycle)
+		 */
+		uint64_t writes = 0;
+		for (AudioPortList::const_iterator it = sources->begin (); it != sources->end (); ++it) {
+			writes += (*it)->write_count ();
+		}
+
+		if (_sum_samples == n_samples && _sum_cycle == cycle_count () && _sum_writes == writes) {
+			return _buffer;
+		}
+
+		AudioPortList::const_iterator it = sources->begin ();
+		if (it == sources->end ()) {
 			memset (_buffer, 0, n_samples * sizeof (Sample));
 		} else {
-			PulseAudioPort* source = static_cast<PulseAudioPort*> (*it);
-			assert (source && source->is_output ());
-			memcpy (_buffer, source->const_buffer (), n_samples * sizeof (Sample));
-			while (++it != connections.end ()) {
-				source = static_cast<PulseAudioPort*> (*it);
-				assert (source && source->is_output ());
-				Sample*       dst = buffer ();
-				const Sample* src = source->const_buffer ();
-				for (uint32_t s = 0; s < n_samples; ++s, ++dst, ++src) {
-					*dst += *src;
-				}
+			copy_vector (_buffer, (*it)->const_buffer (), n_samples);
+			while (++it != sources->end ()) {
+				mix_buffers_no_gain (_buffer, (*it)->const_buffer (), n_samples);
 			}
 		}
+
+		_sum_cycle   = cycle_count ();
+		_sum_writes  = writes;
+		_sum_samples = n_samples;
+	} else {
+		g_atomic_int_inc (&_write_count);
 	}
 	return _buffer;
 }
 
+void
+PulseAudioPort::connections_changed ()
+{
+	if (!is_input ()) {
+		return;
+	}
+
+	{
+		RCUWriter<AudioPortList>         writer (_sources);
+		boost::shared_ptr<AudioPortList> sources = writer.get_copy ();
+		sources->clear ();
+
+		const std::set<PulsePort*>& connections = get_connections ();
+		for (std::set<PulsePort*>::const_iterator it = connections.begin (); it != connections.end (); ++it) {
+			assert ((*it)->is_output ());
+			sources->push_back (static_cast<PulseAudioPort const*> (*it));
+		}
+	}
+
+	/* force summing the new set of sources */
+	_sum_samples = 0;
+}
+
 PulseMidiPort::PulseMidiPort (PulseAudioBackend& b, const std::string& name, PortFlags flags)
     : PulsePort (b, name, flags)
 {
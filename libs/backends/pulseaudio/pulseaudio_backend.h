@@ -34,6 +34,7 @@
 #include "ardour/audio_backend.h"
 #include "ardour/dsp_load_calculator.h"
 #include "pbd/natsort.h"
+#include "pbd/rcu.h"
 
 #define MaxPulseMidiEventSize (256)
 
@@ -108,6 +109,11 @@ public:
 	void set_latency_range (const LatencyRange& latency_range, bool for_playback);
 	void update_connected_latency (bool for_playback);
 
+protected:
+	/** called when connections change, not realtime safe */
+	virtual void connections_changed () {}
+	uint32_t cycle_count () const;
+
 private:
 	PulseAudioBackend&   _pulse_backend;
 	std::string          _name;
@@ -133,8 +139,27 @@ public:
 	const Sample* const_buffer () const { return _buffer; }
 	void* get_buffer (pframes_t nframes);
 
+	uint32_t write_count () const { return g_atomic_int_get (const_cast<gint*>(&_write_count)); }
+
+protected:
+	void connections_changed ();
+
 private:
 	Sample _buffer[8192];
+
+	/* output ports connected to this input */
+	typedef std::vector<PulseAudioPort const*> AudioPortList;
+	SerializedRCUManager<AudioPortList> _sources;
+
+	/* outputs: incremented whenever the buffer is handed out for writing.
+	 * written by the process thread that owns the port, read by whichever
+	 * thread sums a connected input. */
+	volatile gint _write_count;
+
+	/* inputs: state of the sources when _buffer was summed */
+	uint32_t  _sum_cycle;
+	uint64_t  _sum_writes;
+	pframes_t _sum_samples;
 }; // class PulseAudioPort
 
 class PulseMidiPort : public PulsePort
@@ -340,6 +365,7 @@ private:
 	float                     _dsp_load;
 	ARDOUR::DSPLoadCalculator _dsp_load_calc;
 	samplecnt_t               _processed_samples;
+	uint32_t                  _cycle_count;
 	pthread_t                 _main_thread;
 
 	/* process threads */
@@ -1,5 +1,6 @@
 #include <sys/time.h>
 #include "canvas/group.h"
+#include "canvas/lookup_table.h"
 #include "canvas/canvas.h"
 #include "canvas/root_group.h"
 #include "canvas/rectangle.h"
@@ -9,9 +10,9 @@ using namespace std;
 using namespace ArdourCanvas;
 
 static void
-test (int items_per_cell)
+test (int cell_size)
 {
-	Group::default_items_per_cell = items_per_cell;
+	GridLookupTable::default_cell_size = cell_size;
 
 	int const n_rectangles = 10000;
 	int const n_tests = 1000;
@@ -37,7 +38,7 @@ test (int items_per_cell)
 
 int main ()
 {
-	int tests[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256 };
+	int tests[] = { 16, 32, 64, 128, 256, 512, 1024 };
 
 	for (unsigned int i = 0; i < sizeof (tests) / sizeof (int); ++i) {
 		timeval start;
@@ -58,7 +58,9 @@ Canvas::Canvas ()
 	: _root (this)
 	, _bg_color (Gtkmm2ext::rgba_to_color (0, 1.0, 0.0, 1.0))
 	, _last_render_start_timestamp(0)
+	, _deferred_redraws (false)
 	, _use_intermediate_surface (false)
+	, _n_item_changes (0)
 {
 #ifdef __APPLE__
 	_use_intermediate_surface = true;
@@ -273,6 +275,13 @@ Canvas::item_changed (Item* item, Rect pre_change_bounding_box)
 		}
 	}
 
+	if (_deferred_redraws) {
+		/* the new bounding box is looked at in flush_redraws() */
+		_changed_items.insert (item);
+		++_n_item_changes;
+		return;
+	}
+
 	Rect post_change_bounding_box = item->bounding_box ();
 
 	if (post_change_bounding_box) {
@@ -397,6 +406,12 @@ Canvas::item_moved (Item* item, Rect pre_change_parent_bounding_box)
 		queue_draw_item_area (item->parent(), pre_change_parent_bounding_box);
 	}
 
+	if (_deferred_redraws) {
+		_changed_items.insert (item);
+		++_n_item_changes;
+		return;
+	}
+
 	Rect post_change_bounding_box = item->bounding_box ();
 	if (post_change_bounding_box) {
 		/* request a redraw of where the item now is */
@@ -404,6 +419,69 @@ Canvas::item_moved (Item* item, Rect pre_change_parent_bounding_box)
 	}
 }
 
+void
+Canvas::item_going_away (Item* item, Rect)
+{
+	_changed_items.erase (item);
+}
+
+void
+Canvas::set_deferred_redraws (bool yn)
+{
+	if (_deferred_redraws == yn) {
+		return;
+	}
+
+	if (!yn) {
+		flush_redraws ();
+	}
+
+	_deferred_redraws = yn;
+}
+
+void
+Canvas::flush_redraws ()
+{
+	if (!_deferred_redraws) {
+		return;
+	}
+
+	/* items may have changed many times since the last flush, but
+	 * their new bounding boxes only need to be computed once.
+	 */
+
+	if (!_changed_items.empty()) {
+
+		Rect const window_bbox = visible_area ();
+		std::set<Item*> changed;
+		changed.swap (_changed_items);
+
+		for (std::set<Item*>::const_iterator i = changed.begin(); i != changed.end(); ++i) {
+
+			if (!(*i)->visible()) {
+				/* hiding it will have queued a redraw already */
+				continue;
+			}
+
+			Rect const bbox = (*i)->bounding_box ();
+
+			if (!bbox) {
+				continue;
+			}
+
+			Rect const window_intersection = (*i)->item_to_window (bbox).intersection (window_bbox);
+
+			if (window_intersection) {
+				queue_draw_item_area (*i, bbox);
+				(*i)->prepare_for_render (window_intersection);
+			}
+		}
+	}
+
+	flush_redraw_requests (_n_item_changes);
+	_n_item_changes = 0;
+}
+
 /** Request a redraw of a particular area in an item's coordinates.
  *  @param item Item.
  *  @param area Area to redraw in the item's coordinates.
@@ -452,6 +530,7 @@ GtkCanvas::GtkCanvas ()
 	, tooltip_window (0)
 	, _in_dtor (false)
 	, _nsglview (0)
+	, _n_redraw_requests (0)
 {
 #ifdef USE_CAIRO_IMAGE_SURFACE /* usually Windows builds */
 	_use_image_surface = true;
@@ -807,6 +886,8 @@ GtkCanvas::item_shown_or_hidden (Item* item)
 void
 GtkCanvas::item_going_away (Item* item, Rect bounding_box)
 {
+	Canvas::item_going_away (item, bounding_box);
+
 	if (bounding_box) {
 		queue_draw_item_area (item, bounding_box);
 	}
@@ -1241,7 +1322,11 @@ GtkCanvas::request_redraw (Rect const & request)
 	if (real_area) {
 		if (real_area.width () && real_area.height ()) {
 			// Item intersects with visible canvas area
-			queue_draw_area (real_area.x0, real_area.y0, real_area.width(), real_area.height());
+			if (_deferred_redraws) {
+				add_pending_redraw (real_area);
+			} else {
+				queue_draw_area (real_area.x0, real_area.y0, real_area.width(), real_area.height());
+			}
 		}
 
 	} else {
@@ -1249,6 +1334,65 @@ GtkCanvas::request_redraw (Rect const & request)
 	}
 }
 
+static double
+area (Rect const & r)
+{
+	return r.width() * r.height();
+}
+
+/** Add @a r to the areas to be redrawn at the next flush_redraws(),
+ *  merging it with those that it overlaps (or nearly so), since one
+ *  larger area is cheaper to expose than several overlapping ones.
+ */
+void
+GtkCanvas::add_pending_redraw (Rect r)
+{
+	static const size_t max_pending_redraws = 16;
+
+	++_n_redraw_requests;
+
+	for (std::vector<Rect>::iterator i = _pending_redraws.begin(); i != _pending_redraws.end(); ) {
+		Rect const u = i->extend (r);
+		if (area (u) <= area (*i) + area (r)) {
+			/* merging does not add more than it saves */
+			r = u;
+			i = _pending_redraws.erase (i);
+		} else {
+			++i;
+		}
+	}
+
+	if (_pending_redraws.size() >= max_pending_redraws) {
+		for (std::vector<Rect>::const_iterator i = _pending_redraws.begin(); i != _pending_redraws.end(); ++i) {
+			r = r.extend (*i);
+		}
+		_pending_redraws.clear ();
+	}
+
+	_pending_redraws.push_back (r);
+}
+
+void
+GtkCanvas::flush_redraw_requests (uint32_t items_changed)
+{
+	if (_pending_redraws.empty()) {
+		return;
+	}
+
+	double pixels = 0;
+
+	for (std::vector<Rect>::const_iterator i = _pending_redraws.begin(); i != _pending_redraws.end(); ++i) {
+		queue_draw_area (i->x0, i->y0, i->width(), i->height());
+		pixels += area (*i);
+	}
+
+	DEBUG_TRACE (PBD::DEBUG::CanvasRedraw, string_compose ("frame: %1 item changes, %2 redraw requests as %3 areas, %4 pixels\n",
+	                                                       items_changed, _n_redraw_requests, _pending_redraws.size(), pixels));
+
+	_pending_redraws.clear ();
+	_n_redraw_requests = 0;
+}
+
 /** Called to request that we try to get a particular size for ourselves.
  *  @param size Size to request, in pixels.
  */
@@ -28,6 +28,7 @@
 #define __CANVAS_CANVAS_H__
 
 #include <set>
+#include <vector>
 
 #include <gtkmm/alignment.h>
 #include <gtkmm/eventbox.h>
@@ -106,7 +107,7 @@ public:
 	Gtkmm2ext::Color background_color() const { return _bg_color; }
 
 	/** Called when an item is being destroyed */
-	virtual void item_going_away (Item *, Rect) {}
+	virtual void item_going_away (Item *, Rect);
 	virtual void item_shown_or_hidden (Item *);
 	void item_visual_property_changed (Item*);
 	void item_changed (Item *, Rect);
@@ -173,6 +174,20 @@ public:
 
 	virtual Glib::RefPtr<Pango::Context> get_pango_context() = 0;
 
+	/** Collect redraw requests, and the items whose bounding boxes have
+	 * changed, and only act on them when flush_redraws() is called.
+	 * When many items change at once (e.g. dragging many regions),
+	 * this avoids recomputing their bounding boxes and invalidating the
+	 * window for every single change.
+	 */
+	void set_deferred_redraws (bool yn);
+	bool deferred_redraws () const { return _deferred_redraws; }
+
+	/** Request redraws for everything that changed since the last call.
+	 * To be called once per display frame if deferred_redraws() is set.
+	 */
+	void flush_redraws ();
+
 	/** Redirect drawing to an intermediate (image) surface.
 	 * see also https://www.cairographics.org/manual/cairo-cairo-t.html#cairo-push-group
 	 */
@@ -190,9 +205,21 @@ protected:
 	virtual void pick_current_item (int state) = 0;
 	virtual void pick_current_item (Duple const &, int state) = 0;
 
+	/** Called by flush_redraws() to act on the redraw requests that
+	 * were collected while deferred_redraws() was set.
+	 * @param items_changed number of item changes since the last flush.
+	 */
+	virtual void flush_redraw_requests (uint32_t items_changed) {}
+
 	std::list<ScrollGroup*> scrollers;
 
+	bool _deferred_redraws;
 	bool _use_intermediate_surface;
+
+private:
+	/** items which changed while redraws were deferred */
+	std::set<Item*> _changed_items;
+	uint32_t _n_item_changes;
 };
 
 /** A canvas which renders onto a GTK EventBox */
@@ -293,6 +320,13 @@ private:
 
 	void* _nsglview;
 	Cairo::RefPtr<Cairo::Surface> _canvas_image;
+
+	void flush_redraw_requests (uint32_t items_changed);
+	void add_pending_redraw (Rect);
+
+	/** areas to redraw while redraws are deferred, in window coordinates */
+	std::vector<Rect> _pending_redraws;
+	uint32_t _n_redraw_requests;
 };
 
 /** A GTK::Alignment with a GtkCanvas inside it plus some Gtk::Adjustments for
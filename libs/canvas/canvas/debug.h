@@ -32,6 +32,7 @@ namespace PBD {
 		LIBCANVAS_API extern DebugBits CanvasEvents;
 		LIBCANVAS_API extern DebugBits CanvasRender;
 		LIBCANVAS_API extern DebugBits CanvasEnterLeave;
+		LIBCANVAS_API extern DebugBits CanvasRedraw;
 	}
 }
 
@@ -309,6 +309,7 @@ protected:
 	/* nesting ("grouping") API */
 
 	void invalidate_lut () const;
+	void update_lut (LookupTable::Change, Item*) const;
 	void clear_items (bool with_delete);
 
 	void ensure_lut () const;
@@ -325,6 +326,7 @@ protected:
 
 private:
 	void init ();
+	void notify_parent_lut () const;
 
 	std::string _tooltip;
 	bool _ignore_events;
@@ -20,8 +20,10 @@
 #ifndef __CANVAS_LOOKUP_TABLE_H__
 #define __CANVAS_LOOKUP_TABLE_H__
 
+#include <map>
 #include <vector>
 #include <boost/multi_array.hpp>
+#include <stdint.h>
 
 #include "canvas/visibility.h"
 #include "canvas/types.h"
@@ -42,6 +44,19 @@ public:
     virtual std::vector<Item*> items_at_point (Duple const &) const = 0;
     virtual bool has_item_at_point (Duple const & point) const = 0;
 
+    enum Change {
+	    ItemAdded,     ///< item was added to our item's children
+	    ItemRemoved,   ///< item was removed (and may be in the middle of deletion)
+	    ItemChanged,   ///< item's position or bounding box may have changed
+	    ItemRestacked  ///< item's position in the stacking order has changed
+    };
+
+    /** Called by our item when one of its children changes.
+     *  @return false if the table cannot follow the change and
+     *  must be rebuilt.
+     */
+    virtual bool update (Change, Item*) { return false; }
+
 protected:
 
     Item const & _item;
@@ -55,6 +70,66 @@ public:
     std::vector<Item*> get (Rect const &);
     std::vector<Item*> items_at_point (Duple const &) const;
     bool has_item_at_point (Duple const & point) const;
+    bool update (Change, Item*);
+};
+
+/** A uniform grid over the bounding boxes of our item's children (in
+ *  our item's coordinates), which is updated as children are added,
+ *  removed, moved or resized rather than being rebuilt.
+ *
+ *  Items that would occupy more than max_cells_per_item cells (such
+ *  as track backgrounds spanning the whole timeline) are kept in a
+ *  separate list which is always searched.
+ */
+class LIBCANVAS_API GridLookupTable : public LookupTable
+{
+public:
+    GridLookupTable (Item const &);
+
+    std::vector<Item*> get (Rect const &);
+    std::vector<Item*> items_at_point (Duple const &) const;
+    bool has_item_at_point (Duple const & point) const;
+    bool update (Change, Item*);
+
+    /** size of a (square) grid cell in tables created from now on */
+    static Coord default_cell_size;
+    /** number of children above which an item uses a GridLookupTable */
+    static uint32_t min_items;
+    static uint32_t max_cells_per_item;
+
+  private:
+    typedef std::pair<int, int> CellIndex;
+    typedef std::vector<Item*> Cell;
+
+    struct Entry {
+	    Entry () : order (0), indexed (false), large (false), dirty (true), x0 (0), y0 (0), x1 (0), y1 (0) {}
+	    int64_t order; ///< position in the stacking order, lowest first
+	    bool indexed;  ///< true if the item is in _cells or _large
+	    bool large;
+	    bool dirty;    ///< true if the item's cells need to be recomputed
+	    int x0, y0, x1, y1; ///< cells covered, inclusive
+    };
+
+    typedef std::map<Item*, Entry> Entries;
+
+    void flush () const;
+    void insert (Item*, Entry&) const;
+    void erase (Item*, Entry&) const;
+    void restack ();
+    void set_order (Item*, Entry&);
+    void candidates (Rect const &, std::vector<std::pair<int64_t, Item*> >&) const;
+    bool window_to_table (Rect&) const;
+
+    /* the table is brought up to date when it is queried, which may
+     * be in const methods.
+     */
+    mutable Entries _entries;
+    mutable std::map<CellIndex, Cell> _cells;
+    mutable Cell _large;
+    mutable Cell _dirty;
+    Coord _cell_size;
+    int64_t _front;
+    int64_t _back;
 };
 
 class LIBCANVAS_API OptimizingLookupTable : public LookupTable
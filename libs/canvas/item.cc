@@ -271,6 +271,8 @@ Item::set_position (Duple p)
 
 	_position = p;
 
+	notify_parent_lut ();
+
 	/* only update canvas and parent if visible. Otherwise, this
 	   will be done when ::show() is called.
 	*/
@@ -377,6 +379,8 @@ Item::propagate_show_hide ()
 {
 	/* bounding box may have changed while we were hidden */
 
+	notify_parent_lut ();
+
 	if (_parent) {
 		_parent->child_changed ();
 	}
@@ -575,6 +579,7 @@ void
 Item::size_allocate (Rect const & r)
 {
 	_allocation = r;
+	notify_parent_lut ();
 }
 
 /** @return Bounding box in this item's coordinates */
@@ -636,6 +641,8 @@ Item::begin_change ()
 void
 Item::end_change ()
 {
+	notify_parent_lut ();
+
 	if (visible()) {
 		_canvas->item_changed (this, _pre_change_bounding_box);
 
@@ -914,8 +921,11 @@ Item::add (Item* i)
 
 	_items.push_back (i);
 	i->reparent (this, true);
-	invalidate_lut ();
+	update_lut (LookupTable::ItemAdded, i);
 	_bounding_box_dirty = true;
+
+	/* our bounding box may have changed, even if we are hidden */
+	notify_parent_lut ();
 }
 
 void
@@ -925,8 +935,11 @@ Item::add_front (Item* i)
 
 	_items.push_front (i);
 	i->reparent (this, true);
-	invalidate_lut ();
+	update_lut (LookupTable::ItemAdded, i);
 	_bounding_box_dirty = true;
+
+	/* our bounding box may have changed, even if we are hidden */
+	notify_parent_lut ();
 }
 
 void
@@ -951,7 +964,7 @@ Item::remove (Item* i)
 
 	i->unparent ();
 	_items.remove (i);
-	invalidate_lut ();
+	update_lut (LookupTable::ItemRemoved, i);
 	_bounding_box_dirty = true;
 
 	end_change ();
@@ -967,6 +980,8 @@ Item::clear (bool with_delete)
 	invalidate_lut ();
 	_bounding_box_dirty = true;
 
+	notify_parent_lut ();
+
 	end_change ();
 }
 
@@ -1008,7 +1023,7 @@ Item::raise_child_to_top (Item* i)
 	_items.remove (i);
 	_items.push_back (i);
 
-	invalidate_lut ();
+	update_lut (LookupTable::ItemRestacked, i);
         redraw ();
 }
 
@@ -1027,7 +1042,7 @@ Item::raise_child (Item* i, int levels)
 	}
 
 	_items.insert (j, i);
-	invalidate_lut ();
+	update_lut (LookupTable::ItemRestacked, i);
         redraw ();
 }
 
@@ -1041,7 +1056,7 @@ Item::lower_child_to_bottom (Item* i)
 	}
 	_items.remove (i);
 	_items.push_front (i);
-	invalidate_lut ();
+	update_lut (LookupTable::ItemRestacked, i);
         redraw ();
 }
 
@@ -1049,7 +1064,11 @@ void
 Item::ensure_lut () const
 {
 	if (!_lut) {
-		_lut = new DumbLookupTable (*this);
+		if (_items.size() >= GridLookupTable::min_items) {
+			_lut = new GridLookupTable (*this);
+		} else {
+			_lut = new DumbLookupTable (*this);
+		}
 	}
 }
 
@@ -1060,12 +1079,37 @@ Item::invalidate_lut () const
 	_lut = 0;
 }
 
+/** Tell our lookup table that child @a i has been added, removed,
+ *  restacked or changed, rebuilding the table if it can't follow
+ *  the change by itself.
+ */
+void
+Item::update_lut (LookupTable::Change c, Item* i) const
+{
+	if (_lut && !_lut->update (c, i)) {
+		invalidate_lut ();
+	}
+}
+
+/** Tell our parent's lookup table that our position or bounding box
+ *  may have changed. This is done even if we are hidden, so that the
+ *  table never holds out of date positions.
+ */
+void
+Item::notify_parent_lut () const
+{
+	if (_parent) {
+		_parent->update_lut (LookupTable::ItemChanged, const_cast<Item*> (this));
+	}
+}
+
 void
 Item::child_changed ()
 {
-	invalidate_lut ();
 	_bounding_box_dirty = true;
 
+	notify_parent_lut ();
+
 	if (_parent) {
 		_parent->child_changed ();
 	}
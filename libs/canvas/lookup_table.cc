@@ -18,6 +18,11 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cmath>
+
 #include "canvas/item.h"
 #include "canvas/lookup_table.h"
 
@@ -104,6 +109,343 @@ DumbLookupTable::has_item_at_point (Duple const & point) const
 	return false;
 }
 
+bool
+DumbLookupTable::update (Change c, Item*)
+{
+	/* there is nothing to update, but once our item has many children
+	 * it is time to switch to a GridLookupTable.
+	 */
+	return !(c == ItemAdded && _item.items().size() >= GridLookupTable::min_items);
+}
+
+Coord GridLookupTable::default_cell_size = 128;
+uint32_t GridLookupTable::min_items = 64;
+uint32_t GridLookupTable::max_cells_per_item = 256;
+
+GridLookupTable::GridLookupTable (Item const & item)
+	: LookupTable (item)
+	, _cell_size (default_cell_size)
+	, _front (0)
+	, _back (-1)
+{
+	list<Item*> const & items = _item.items ();
+
+	for (list<Item*>::const_iterator i = items.begin(); i != items.end(); ++i) {
+		Entry& e (_entries[*i]);
+		e.order = ++_back;
+		_dirty.push_back (*i);
+	}
+}
+
+/** Convert @a r from window coordinates to those of our item's children's
+ *  bounding boxes after item_to_parent(), i.e. our item's coordinates as
+ *  seen by its children (which may have a different scroll parent).
+ */
+bool
+GridLookupTable::window_to_table (Rect& r) const
+{
+	list<Item*> const & items = _item.items ();
+
+	if (items.empty()) {
+		return false;
+	}
+
+	Item const * child = items.front ();
+
+	/* allow for rounding in Item::item_to_window() */
+	r = child->item_to_parent (child->window_to_item (r)).expand (1.0);
+
+	return true;
+}
+
+void
+GridLookupTable::insert (Item* item, Entry& e) const
+{
+	Rect const bbox = item->bounding_box ();
+
+	if (!bbox) {
+		return;
+	}
+
+	Rect const r = item->item_to_parent (bbox);
+
+	double const x0 = floor (r.x0 / _cell_size);
+	double const y0 = floor (r.y0 / _cell_size);
+	double const x1 = floor (r.x1 / _cell_size);
+	double const y1 = floor (r.y1 / _cell_size);
+
+	e.indexed = true;
+
+	if ((x1 - x0 + 1) * (y1 - y0 + 1) > max_cells_per_item ||
+	    fabs (x0) > INT_MAX / 2 || fabs (y0) > INT_MAX / 2 ||
+	    fabs (x1) > INT_MAX / 2 || fabs (y1) > INT_MAX / 2) {
+		e.large = true;
+		_large.push_back (item);
+		return;
+	}
+
+	e.large = false;
+	e.x0 = (int) x0;
+	e.y0 = (int) y0;
+	e.x1 = (int) x1;
+	e.y1 = (int) y1;
+
+	for (int x = e.x0; x <= e.x1; ++x) {
+		for (int y = e.y0; y <= e.y1; ++y) {
+			_cells[CellIndex (x, y)].push_back (item);
+		}
+	}
+}
+
+void
+GridLookupTable::erase (Item* item, Entry& e) const
+{
+	if (!e.indexed) {
+		return;
+	}
+
+	e.indexed = false;
+
+	if (e.large) {
+		_large.erase (find (_large.begin(), _large.end(), item));
+		return;
+	}
+
+	for (int x = e.x0; x <= e.x1; ++x) {
+		for (int y = e.y0; y <= e.y1; ++y) {
+			map<CellIndex, Cell>::iterator c = _cells.find (CellIndex (x, y));
+			assert (c != _cells.end());
+			c->second.erase (find (c->second.begin(), c->second.end(), item));
+			if (c->second.empty()) {
+				_cells.erase (c);
+			}
+		}
+	}
+}
+
+/** Re-index all children which have changed since the last query */
+void
+GridLookupTable::flush () const
+{
+	for (Cell::const_iterator i = _dirty.begin(); i != _dirty.end(); ++i) {
+
+		Entries::iterator e = _entries.find (*i);
+
+		if (e == _entries.end() || !e->second.dirty) {
+			/* removed, or already dealt with */
+			continue;
+		}
+
+		erase (e->first, e->second);
+		insert (e->first, e->second);
+		e->second.dirty = false;
+	}
+
+	_dirty.clear ();
+}
+
+void
+GridLookupTable::restack ()
+{
+	list<Item*> const & items = _item.items ();
+
+	_front = 0;
+	_back = -1;
+
+	for (list<Item*>::const_iterator i = items.begin(); i != items.end(); ++i) {
+		Entries::iterator e = _entries.find (*i);
+		if (e != _entries.end()) {
+			e->second.order = ++_back;
+		}
+	}
+}
+
+void
+GridLookupTable::set_order (Item* item, Entry& e)
+{
+	list<Item*> const & items = _item.items ();
+
+	if (items.back() == item) {
+		e.order = ++_back;
+	} else if (items.front() == item) {
+		e.order = --_front;
+	} else {
+		restack ();
+	}
+}
+
+bool
+GridLookupTable::update (Change c, Item* item)
+{
+	Entries::iterator i = _entries.find (item);
+
+	switch (c) {
+	case ItemAdded:
+		if (i == _entries.end()) {
+			i = _entries.insert (make_pair (item, Entry ())).first;
+		}
+		set_order (item, i->second);
+		/* the item may not even be fully constructed yet, so its
+		 * bounding box is only looked at when we are next queried.
+		 */
+		i->second.dirty = true;
+		_dirty.push_back (item);
+		break;
+
+	case ItemRemoved:
+		if (i != _entries.end()) {
+			erase (item, i->second);
+			_entries.erase (i);
+		}
+		if (_entries.size() < min_items / 2) {
+			/* not worth it any more */
+			return false;
+		}
+		break;
+
+	case ItemChanged:
+		if (i != _entries.end() && !i->second.dirty) {
+			i->second.dirty = true;
+			_dirty.push_back (item);
+		}
+		break;
+
+	case ItemRestacked:
+		if (i != _entries.end()) {
+			set_order (item, i->second);
+		}
+		break;
+	}
+
+	return true;
+}
+
+/** Find the items whose cells intersect @a area (in table coordinates),
+ *  sorted from lowest to highest in the stack.
+ */
+void
+GridLookupTable::candidates (Rect const & area, vector<pair<int64_t, Item*> >& found) const
+{
+	double const x0 = floor (area.x0 / _cell_size);
+	double const y0 = floor (area.y0 / _cell_size);
+	double const x1 = floor (area.x1 / _cell_size);
+	double const y1 = floor (area.y1 / _cell_size);
+
+	if ((x1 - x0 + 1) * (y1 - y0 + 1) > _cells.size() ||
+	    fabs (x0) > INT_MAX / 2 || fabs (y0) > INT_MAX / 2 ||
+	    fabs (x1) > INT_MAX / 2 || fabs (y1) > INT_MAX / 2) {
+
+		/* visiting the cells would be more work than looking at all items */
+
+		for (Entries::const_iterator i = _entries.begin(); i != _entries.end(); ++i) {
+			if (i->second.indexed && !i->second.large) {
+				found.push_back (make_pair (i->second.order, i->first));
+			}
+		}
+
+	} else {
+
+		for (int x = (int) x0; x <= (int) x1; ++x) {
+			for (int y = (int) y0; y <= (int) y1; ++y) {
+				map<CellIndex, Cell>::const_iterator c = _cells.find (CellIndex (x, y));
+				if (c == _cells.end()) {
+					continue;
+				}
+				for (Cell::const_iterator i = c->second.begin(); i != c->second.end(); ++i) {
+					found.push_back (make_pair (_entries[*i].order, *i));
+				}
+			}
+		}
+	}
+
+	for (Cell::const_iterator i = _large.begin(); i != _large.end(); ++i) {
+		found.push_back (make_pair (_entries[*i].order, *i));
+	}
+
+	/* items covering several cells will have been found more than once */
+	sort (found.begin(), found.end());
+	found.erase (unique (found.begin(), found.end()), found.end());
+}
+
+vector<Item*>
+GridLookupTable::get (Rect const & area)
+{
+	vector<Item*> vitems;
+	Rect r (area);
+
+	if (!window_to_table (r)) {
+		return vitems;
+	}
+
+	flush ();
+
+	vector<pair<int64_t, Item*> > found;
+	candidates (r, found);
+
+	/* same test as DumbLookupTable, for the candidates only */
+	for (vector<pair<int64_t, Item*> >::const_iterator i = found.begin(); i != found.end(); ++i) {
+		Item* item = i->second;
+		Rect item_bbox = item->bounding_box ();
+		if (!item_bbox) continue;
+		if (item->item_to_window (item_bbox).intersection (area)) {
+			vitems.push_back (item);
+		}
+	}
+
+	return vitems;
+}
+
+vector<Item*>
+GridLookupTable::items_at_point (Duple const & point) const
+{
+	/* Point is in window coordinate system */
+
+	vector<Item*> vitems;
+	Rect r (point.x, point.y, point.x, point.y);
+
+	if (!window_to_table (r)) {
+		return vitems;
+	}
+
+	flush ();
+
+	vector<pair<int64_t, Item*> > found;
+	candidates (r, found);
+
+	for (vector<pair<int64_t, Item*> >::const_iterator i = found.begin(); i != found.end(); ++i) {
+		if (i->second->covers (point)) {
+			vitems.push_back (i->second);
+		}
+	}
+
+	return vitems;
+}
+
+bool
+GridLookupTable::has_item_at_point (Duple const & point) const
+{
+	/* Point is in window coordinate system */
+
+	Rect r (point.x, point.y, point.x, point.y);
+
+	if (!window_to_table (r)) {
+		return false;
+	}
+
+	flush ();
+
+	vector<pair<int64_t, Item*> > found;
+	candidates (r, found);
+
+	for (vector<pair<int64_t, Item*> >::const_iterator i = found.begin(); i != found.end(); ++i) {
+		if (i->second->visible() && i->second->covers (point)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 OptimizingLookupTable::OptimizingLookupTable (Item const & item, int items_per_cell)
 	: LookupTable (item)
 	, _items_per_cell (items_per_cell)
@@ -162,12 +162,16 @@ Panner1in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float) (limit));
 
+		pan_t ramp[64];
+
 		for (n = 0; n < limit; n++) {
 			left_interp = left_interp + delta;
 			left = left_interp + 0.9 * (left - left_interp);
-			dst[n] += src[n] * left * gain_coeff;
+			ramp[n] = left * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, ramp, limit);
+
 		/* then pan the rest of the buffer; no need for interpolation for this bit */
 
 		pan = left * gain_coeff;
@@ -217,12 +221,16 @@ Panner1in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float) (limit));
 
+		pan_t ramp[64];
+
 		for (n = 0; n < limit; n++) {
 			right_interp = right_interp + delta;
 			right = right_interp + 0.9 * (right - right_interp);
-			dst[n] += src[n] * right * gain_coeff;
+			ramp[n] = right * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, ramp, limit);
+
 		/* then pan the rest of the buffer, no need for interpolation for this bit */
 
 		pan = right * gain_coeff;
@@ -266,8 +274,6 @@ Panner1in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 {
 	assert (obufs.count().n_audio() == 2);
 
-	Sample* dst;
-	pan_t* pbuf;
 	Sample* const src = srcbuf.data();
         pan_t* const position = buffers[0];
 
@@ -304,23 +310,13 @@ Panner1in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 
 	/* LEFT OUTPUT */
 
-	dst = obufs.get_audio(0).data();
-	pbuf = buffers[0];
-
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (obufs.get_audio(0).data(), src, buffers[0], nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 
 	/* RIGHT OUTPUT */
 
-	dst = obufs.get_audio(1).data();
-	pbuf = buffers[1];
-
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (obufs.get_audio(1).data(), src, buffers[1], nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 }
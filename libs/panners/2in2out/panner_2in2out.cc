@@ -288,12 +288,16 @@ Panner2in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float) (limit));
 
+		pan_t ramp[64];
+
 		for (n = 0; n < limit; n++) {
 			left_interp[which] = left_interp[which] + delta;
 			left[which] = left_interp[which] + 0.9 * (left[which] - left_interp[which]);
-			dst[n] += src[n] * left[which] * gain_coeff;
+			ramp[n] = left[which] * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, ramp, limit);
+
 		/* then pan the rest of the buffer; no need for interpolation for this bit */
 
 		pan = left[which] * gain_coeff;
@@ -344,12 +348,16 @@ Panner2in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float) (limit));
 
+		pan_t ramp[64];
+
 		for (n = 0; n < limit; n++) {
 			right_interp[which] = right_interp[which] + delta;
 			right[which] = right_interp[which] + 0.9 * (right[which] - right_interp[which]);
-			dst[n] += src[n] * right[which] * gain_coeff;
+			ramp[n] = right[which] * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, ramp, limit);
+
 		/* then pan the rest of the buffer, no need for interpolation for this bit */
 
 		pan = right[which] * gain_coeff;
@@ -393,8 +401,6 @@ Panner2in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 {
 	assert (obufs.count().n_audio() == 2);
 
-	Sample* dst;
-	pan_t* pbuf;
 	Sample* const src = srcbuf.data();
         pan_t* const position = buffers[0];
         pan_t* const width = buffers[1];
@@ -420,19 +426,15 @@ Panner2in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 	const float pan_law_attenuation = -3.0f;
 	const float scale = 2.0f - 4.0f * powf (10.0f,pan_law_attenuation/20.0f);
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-
-                float panR;
+	/* the left signal is panned to center - width/2, the right signal
+	   to center + width/2. Decide that once, so that the loop below has
+	   no branches and can be vectorized.
+	*/
+	const float half_width = (which == 0) ? -0.5f : 0.5f;
 
-                if (which == 0) {
-                        // panning left signal
-                        panR = position[n] - (width[n]/2.0f); // center - width/2
-                } else {
-                        // panning right signal
-                        panR = position[n] + (width[n]/2.0f); // center - width/2
-                }
+	for (pframes_t n = 0; n < nframes; ++n) {
 
-                panR = max(0.f, min(1.f, panR));
+                const float panR = max (0.f, min (1.f, position[n] + half_width * width[n]));
 
                 const float panL = 1 - panR;
 
@@ -449,23 +451,13 @@ Panner2in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 
 	/* LEFT OUTPUT */
 
-	dst = obufs.get_audio(0).data();
-	pbuf = buffers[0];
-
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (obufs.get_audio(0).data(), src, buffers[0], nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 
 	/* RIGHT OUTPUT */
 
-	dst = obufs.get_audio(1).data();
-	pbuf = buffers[1];
-
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (obufs.get_audio(1).data(), src, buffers[1], nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 }
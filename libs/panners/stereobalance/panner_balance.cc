@@ -171,12 +171,16 @@ Pannerbalance::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float) (limit));
 
+		pan_t ramp[64];
+
 		for (n = 0; n < limit; n++) {
 			pos_interp[which] = pos_interp[which] + delta;
 			pos[which] = pos_interp[which] + 0.9 * (pos[which] - pos_interp[which]);
-			dst[n] += src[n] * pos[which] * gain_coeff;
+			ramp[n] = pos[which] * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, ramp, limit);
+
 		/* then pan the rest of the buffer; no need for interpolation for this bit */
 
 		pan = pos[which] * gain_coeff;
@@ -217,10 +221,9 @@ Pannerbalance::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 {
 	assert (obufs.count().n_audio() == 2);
 
-	Sample* dst;
-	pan_t* pbuf;
 	Sample* const src = srcbuf.data();
 	pan_t* const position = buffers[0];
+	pan_t* const pbuf = buffers[which];
 
 	/* fetch positional data */
 
@@ -230,31 +233,21 @@ Pannerbalance::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 		return;
 	}
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-
-		float const pos = position[n];
-
-		if (which == 0) { // Left
-			if (pos > .5) {
-				buffers[which][n] = 2 - 2. * pos;
-			} else {
-				buffers[which][n] = 1.0;
-			}
-		} else { // Right
-			if (pos < .5) {
-				buffers[which][n] = 2. * pos;
-			} else {
-				buffers[which][n] = 1.0;
-			}
+	/* Left:  1 for pos <= .5, falling to 0 at pos = 1
+	 * Right: 1 for pos >= .5, falling to 0 at pos = 0
+	 * written as min() so that the loop can be vectorized.
+	 */
+	if (which == 0) {
+		for (pframes_t n = 0; n < nframes; ++n) {
+			pbuf[n] = min (1.f, 2.f - 2.f * position[n]);
+		}
+	} else {
+		for (pframes_t n = 0; n < nframes; ++n) {
+			pbuf[n] = min (1.f, 2.f * position[n]);
 		}
 	}
 
-	dst = obufs.get_audio(which).data();
-	pbuf = buffers[which];
-
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (obufs.get_audio(which).data(), src, pbuf, nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 }
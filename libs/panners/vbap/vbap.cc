@@ -122,13 +122,23 @@ VBAPanner::configure_io (ChanCount in, ChanCount /* ignored - we use Speakers */
 
 void
 VBAPanner::update ()
+{
+        update_signals (_pannable->pan_azimuth_control->get_value(),
+                        _pannable->pan_width_control->get_value(),
+                        _pannable->pan_elevation_control->get_value());
+
+        SignalPositionChanged(); /* emit */
+}
+
+void
+VBAPanner::update_signals (double azimuth, double width, double elevation)
 {
         /* recompute signal directions based on panner azimuth and, if relevant, width (diffusion) and elevation parameters */
-        double elevation = _pannable->pan_elevation_control->get_value() * 90.0;
+        elevation *= 90.0;
 
         if (_signals.size() > 1) {
-                double w = - (_pannable->pan_width_control->get_value());
-                double signal_direction = 1.0 - (_pannable->pan_azimuth_control->get_value() + (w/2));
+                double w = - width;
+                double signal_direction = 1.0 - (azimuth + (w/2));
                 double grd_step_per_signal = w / (_signals.size() - 1);
                 for (vector<Signal*>::iterator s = _signals.begin(); s != _signals.end(); ++s) {
 
@@ -143,7 +153,7 @@ VBAPanner::update ()
                         signal_direction += grd_step_per_signal;
                 }
         } else if (_signals.size() == 1) {
-                double center = (1.0 - _pannable->pan_azimuth_control->get_value()) * 360.0;
+                double center = (1.0 - azimuth) * 360.0;
 
                 /* width has no role to play if there is only 1 signal: VBAP does not do "diffusion" of a single channel */
 
@@ -151,8 +161,6 @@ VBAPanner::update ()
                 s->direction = AngularVector (center, elevation);
                 compute_gains (s->desired_gains, s->desired_outputs, s->direction.azi, s->direction.ele);
         }
-
-        SignalPositionChanged(); /* emit */
 }
 
 void
@@ -237,10 +245,57 @@ VBAPanner::distribute (BufferSet& inbufs, BufferSet& obufs, gain_t gain_coeffici
         }
 }
 
+void
+VBAPanner::distribute_automated (BufferSet& inbufs, BufferSet& obufs,
+                                 samplepos_t start, samplepos_t end, pframes_t nframes, pan_t** /*buffers*/)
+{
+        assert (inbufs.count().n_audio() == _signals.size());
+
+        /* Finding the speaker tuple and gains for a direction is a search over all
+           tuples, far too expensive to do for every sample. Evaluate the automation
+           and compute the gains once per block instead; distribute_block() ramps
+           from the gains of the previous block to the new ones.
+        */
+
+        const pframes_t block_size = 64;
+
+        for (pframes_t offset = 0; offset < nframes; offset += block_size) {
+
+                pframes_t const n = min (block_size, nframes - offset);
+                double const when = start + (end - start) * (double) offset / nframes;
+
+                update_signals (automation_value (_pannable->pan_azimuth_control, when),
+                                automation_value (_pannable->pan_width_control, when),
+                                automation_value (_pannable->pan_elevation_control, when));
+
+                uint32_t i;
+                vector<Signal*>::iterator s;
+
+                for (s = _signals.begin(), i = 0; s != _signals.end(); ++s, ++i) {
+                        distribute_block (inbufs.get_audio (i), obufs, 1.0, offset, n, i);
+                        memcpy ((*s)->outputs, (*s)->desired_outputs, sizeof ((*s)->outputs));
+                }
+        }
+}
+
+double
+VBAPanner::automation_value (boost::shared_ptr<AutomationControl> ac, double when)
+{
+        bool ok;
+        double const v = ac->list()->rt_safe_eval (when, ok);
+        return ok ? v : ac->get_value ();
+}
+
 void
 VBAPanner::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gain_coefficient, pframes_t nframes, uint32_t which)
 {
-	Sample* const src = srcbuf.data();
+        distribute_block (srcbuf, obufs, gain_coefficient, 0, nframes, which);
+}
+
+void
+VBAPanner::distribute_block (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gain_coefficient, pframes_t offset, pframes_t nframes, uint32_t which)
+{
+	Sample* const src = srcbuf.data (offset);
         Signal* signal (_signals[which]);
 
 	/* VBAP may distribute the signal across up to 3 speakers depending on
@@ -324,7 +379,7 @@ VBAPanner::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gain_co
                         */
 
                         AudioBuffer& buf (obufs.get_audio (output));
-                        buf.accumulate_with_ramped_gain_from (srcbuf.data(), nframes, signal->gains[output], pan, 0);
+                        buf.accumulate_with_ramped_gain_from (src, nframes, signal->gains[output], pan, offset);
                         signal->gains[output] = pan;
 
                 } else {
@@ -332,7 +387,7 @@ VBAPanner::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gain_co
                         /* signal to this output, same gain as before so just copy with gain
                          */
 
-                        mix_buffers_with_gain (obufs.get_audio (output).data(),src,nframes,pan);
+                        mix_buffers_with_gain (obufs.get_audio (output).data (offset),src,nframes,pan);
                         signal->gains[output] = pan;
                 }
 	}
@@ -345,7 +400,7 @@ VBAPanner::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gain_co
                         /* take signal and deliver with a rapid fade out
                          */
                         AudioBuffer& buf (obufs.get_audio (o));
-                        buf.accumulate_with_ramped_gain_from (srcbuf.data(), nframes, signal->gains[o], 0.0, 0);
+                        buf.accumulate_with_ramped_gain_from (src, nframes, signal->gains[o], 0.0, offset);
                         signal->gains[o] = 0.0;
                 }
         }
@@ -361,7 +416,7 @@ VBAPanner::distribute_one_automated (AudioBuffer& /*src*/, BufferSet& /*obufs*/,
                                      samplepos_t /*start*/, samplepos_t /*end*/,
 				     pframes_t /*nframes*/, pan_t** /*buffers*/, uint32_t /*which*/)
 {
-	/* XXX to be implemented */
+	/* not used, automation is handled per block in distribute_automated() */
 }
 
 XMLNode&
@@ -54,6 +54,8 @@ public:
 	static Panner* factory (boost::shared_ptr<Pannable>, boost::shared_ptr<Speakers>);
 
 	void distribute (BufferSet& ibufs, BufferSet& obufs, gain_t gain_coeff, pframes_t nframes);
+	void distribute_automated (BufferSet& ibufs, BufferSet& obufs,
+	                           samplepos_t start, samplepos_t end, pframes_t nframes, pan_t** buffers);
 
 	void set_azimuth_elevation (double azimuth, double elevation);
 
@@ -85,9 +87,12 @@ private:
 
 	void compute_gains (double g[3], int ls[3], int azi, int ele);
         void update ();
+        void update_signals (double azimuth, double width, double elevation);
+        static double automation_value (boost::shared_ptr<AutomationControl>, double when);
         void clear_signals ();
 
 	void distribute_one (AudioBuffer& src, BufferSet& obufs, gain_t gain_coeff, pframes_t nframes, uint32_t which);
+	void distribute_block (AudioBuffer& src, BufferSet& obufs, gain_t gain_coeff, pframes_t offset, pframes_t nframes, uint32_t which);
 	void distribute_one_automated (AudioBuffer& src, BufferSet& obufs,
                                           samplepos_t start, samplepos_t end, pframes_t nframes,
                                           pan_t** buffers, uint32_t which);
@@ -27,3 +27,12 @@ XMLNode &Command::get_state()
 	node->add_content("WARNING: Somebody forgot to subclass Command.");
 	return *node;
 }
+
+size_t
+Command::memory_used ()
+{
+	XMLNode& node (get_state ());
+	size_t const bytes = node.memory_used ();
+	delete &node;
+	return bytes;
+}
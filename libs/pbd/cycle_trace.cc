@@ -0,0 +1,277 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include <glibmm/threads.h>
+
+#include "pbd/cycle_trace.h"
+#include "pbd/pthread_utils.h"
+
+using namespace PBD;
+
+namespace {
+
+/** number of threads that can be traced */
+static const guint max_rings = 32;
+/** events per thread, must be a power of two */
+static const guint ring_size = 8192;
+
+struct Event {
+	int64_t     time;
+	const char* name;
+	uint64_t    id;
+	char        phase;
+};
+
+struct Ring {
+	Ring (guint n)
+		: events (n > 0 ? new Event[n] : 0)
+		, head (0)
+		, in_use (0)
+	{
+		thread_name[0] = '\0';
+	}
+
+	Event*        events;
+	volatile gint head;
+	volatile gint in_use; ///< 1 while a thread records into this ring
+	char          thread_name[32];
+};
+
+static void
+release_ring (void* p)
+{
+	/* called when a thread exits. Rings are owned by the pool and are
+	 * never freed, so that a dump can run concurrently with tracing.
+	 * The events stay until another thread claims the ring.
+	 */
+	Ring* r = static_cast<Ring*> (p);
+	if (r && r->events) {
+		g_atomic_int_set (&r->in_use, 0);
+	}
+}
+
+static Glib::Threads::Private<Ring> thread_ring (release_ring);
+
+static Glib::Threads::Mutex lock;
+static std::vector<Ring*>   rings;
+static volatile gint        rings_ready = 0;
+/** used by threads that did not get a ring */
+static Ring                 overflow_ring (0);
+
+static boost::function<std::string (uint64_t)> id_resolver;
+
+static Ring*
+claim_ring ()
+{
+	if (!g_atomic_int_get (&rings_ready)) {
+		return 0;
+	}
+
+	/* prefer rings which were never used, so that the events of
+	 * threads that are gone are kept as long as possible. */
+	Ring* r = &overflow_ring;
+	for (guint pass = 0; pass < 2 && r == &overflow_ring; ++pass) {
+		for (guint n = 0; n < max_rings; ++n) {
+			if (pass == 0 && g_atomic_int_get (&rings[n]->head) != 0) {
+				continue;
+			}
+			if (g_atomic_int_compare_and_exchange (&rings[n]->in_use, 0, 1)) {
+				r = rings[n];
+				break;
+			}
+		}
+	}
+
+	if (r != &overflow_ring) {
+		/* a concurrent write () drops all events of this ring
+		 * when it notices that the head went backwards */
+		g_atomic_int_set (&r->head, 0);
+		strncpy (r->thread_name, pthread_name (), sizeof (r->thread_name) - 1);
+		r->thread_name[sizeof (r->thread_name) - 1] = '\0';
+	}
+
+	thread_ring.set (r);
+	return r;
+}
+
+static std::string
+json_escape (std::string const& s)
+{
+	std::string rv;
+	for (std::string::const_iterator i = s.begin (); i != s.end (); ++i) {
+		if (*i == '"' || *i == '\\') {
+			rv += '\\';
+			rv += *i;
+		} else if ((unsigned char) *i < 0x20) {
+			char buf[8];
+			snprintf (buf, sizeof (buf), "\\u%04x", (int) *i);
+			rv += buf;
+		} else {
+			rv += *i;
+		}
+	}
+	return rv;
+}
+
+}
+
+volatile gint CycleTrace::_enabled = 0;
+volatile gint CycleTrace::_dump_requested = 0;
+
+void
+CycleTrace::set_enabled (bool yn)
+{
+	if (yn && !g_atomic_int_get (&rings_ready)) {
+		Glib::Threads::Mutex::Lock lm (lock);
+		if (rings.empty ()) {
+			for (guint i = 0; i < max_rings; ++i) {
+				rings.push_back (new Ring (ring_size));
+			}
+		}
+		g_atomic_int_set (&rings_ready, 1);
+	}
+	g_atomic_int_set (&_enabled, yn ? 1 : 0);
+}
+
+void
+CycleTrace::record (const char* name, uint64_t id, char phase)
+{
+	Ring* r = thread_ring.get ();
+
+	if (!r && !(r = claim_ring ())) {
+		return;
+	}
+
+	if (!r->events) {
+		return;
+	}
+
+	/* single writer: only this thread modifies head */
+	const guint h = g_atomic_int_get (&r->head);
+	Event& e = r->events[h & (ring_size - 1)];
+
+	e.time  = g_get_monotonic_time ();
+	e.name  = name;
+	e.id    = id;
+	e.phase = phase;
+
+	g_atomic_int_set (&r->head, h + 1);
+}
+
+void
+CycleTrace::request_dump ()
+{
+	if (enabled ()) {
+		g_atomic_int_set (&_dump_requested, 1);
+	}
+}
+
+bool
+CycleTrace::dump_requested ()
+{
+	return g_atomic_int_compare_and_exchange (&_dump_requested, 1, 0);
+}
+
+void
+CycleTrace::set_id_resolver (boost::function<std::string (uint64_t)> f)
+{
+	Glib::Threads::Mutex::Lock lm (lock);
+	id_resolver = f;
+}
+
+bool
+CycleTrace::write (std::string const& path)
+{
+	Glib::Threads::Mutex::Lock lm (lock);
+
+	std::ofstream o (path.c_str ());
+	if (!o) {
+		return false;
+	}
+
+	std::map<uint64_t, std::string> names;
+	std::vector<Event> events;
+	bool first = true;
+
+	o << "{\"traceEvents\":[\n";
+
+	for (guint t = 0; t < rings.size (); ++t) {
+		Ring* r = rings[t];
+
+		/* copy the ring while it is being written to, then drop
+		 * events that may have been overwritten meanwhile */
+		const guint head = g_atomic_int_get (&r->head);
+		const guint n    = std::min (head, ring_size);
+
+		if (n == 0) {
+			continue;
+		}
+
+		events.resize (n);
+		for (guint i = 0; i < n; ++i) {
+			events[i] = r->events[(head - n + i) & (ring_size - 1)];
+		}
+
+		/* events head .. head_after replace the oldest ones, the
+		 * writer may already be filling the slot of head_after. If the
+		 * ring was claimed by another thread meanwhile, head went
+		 * backwards and everything is dropped.
+		 */
+		const guint head_after = g_atomic_int_get (&r->head);
+		const guint written    = head_after - head + 1;
+		const guint free_slots = ring_size - n;
+		const guint overwritten = written > free_slots ? std::min (n, written - free_slots) : 0;
+
+		o << (first ? "" : ",\n")
+		  << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t + 1
+		  << ",\"args\":{\"name\":\"" << json_escape (r->thread_name) << "\"}}";
+		first = false;
+
+		for (guint i = overwritten; i < n; ++i) {
+			Event const& e (events[i]);
+			std::string name (e.name);
+
+			if (e.id != 0 && id_resolver) {
+				std::map<uint64_t, std::string>::const_iterator it = names.find (e.id);
+				if (it == names.end ()) {
+					it = names.insert (std::make_pair (e.id, id_resolver (e.id))).first;
+				}
+				if (!it->second.empty ()) {
+					name += ": " + it->second;
+				}
+			}
+
+			o << ",\n{\"name\":\"" << json_escape (name) << "\",\"cat\":\"" << json_escape (e.name)
+			  << "\",\"ph\":\"" << e.phase << "\",\"ts\":" << e.time
+			  << ",\"pid\":1,\"tid\":" << t + 1;
+			if (e.id != 0) {
+				o << ",\"args\":{\"id\":" << e.id << "}";
+			}
+			o << "}";
+		}
+	}
+
+	o << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	return o.good ();
+}
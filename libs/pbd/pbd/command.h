@@ -50,6 +50,11 @@ public:
 		return false;
 	}
 
+	/** @return approximate number of bytes retained by this command.
+	 * The default implementation measures the serialized state.
+	 */
+	virtual size_t memory_used ();
+
 protected:
 	Command() {}
 	Command(const std::string& name) : _name(name) {}
@@ -0,0 +1,112 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef __libpbd_cycle_trace_h__
+#define __libpbd_cycle_trace_h__
+
+#include <stdint.h>
+
+#include <string>
+
+#include <boost/function.hpp>
+#include <glib.h>
+
+#include "pbd/libpbd_visibility.h"
+
+namespace PBD {
+
+/** Low overhead tracing for realtime threads.
+ *
+ * Every thread records begin/end events into its own fixed size ring,
+ * without locks or memory allocation. The rings are only read when
+ * writing a trace, which can be loaded into chrome://tracing or
+ * https://ui.perfetto.dev to see what happened in a given process cycle.
+ *
+ * Event names must be string literals, the optional id identifies the
+ * object (e.g. the PBD::ID of a route or processor), see set_id_resolver().
+ */
+class LIBPBD_API CycleTrace
+{
+public:
+	/** Enable or disable tracing. Rings are allocated when tracing is
+	 * enabled for the first time, this is not realtime safe.
+	 */
+	static void set_enabled (bool yn);
+
+	static bool enabled () {
+		return g_atomic_int_get (&_enabled);
+	}
+
+	static void begin (const char* name, uint64_t id = 0) {
+		if (enabled ()) {
+			record (name, id, 'B');
+		}
+	}
+
+	static void end (const char* name, uint64_t id = 0) {
+		if (enabled ()) {
+			record (name, id, 'E');
+		}
+	}
+
+	/** Ask for the rings to be written, e.g. after an xrun.
+	 * Realtime safe; the actual write is done by whoever polls
+	 * dump_requested().
+	 */
+	static void request_dump ();
+
+	/** @return true (once) if a dump was requested */
+	static bool dump_requested ();
+
+	/** Write the current content of all rings in Chrome trace event
+	 * (JSON) format. Not realtime safe.
+	 */
+	static bool write (std::string const& path);
+
+	/** Map event ids to human readable names when writing a trace */
+	static void set_id_resolver (boost::function<std::string (uint64_t)>);
+
+private:
+	static void record (const char* name, uint64_t id, char phase);
+
+	static volatile gint _enabled;
+	static volatile gint _dump_requested;
+};
+
+/** Trace a scope */
+class LIBPBD_API CycleTraceScope
+{
+public:
+	CycleTraceScope (const char* name, uint64_t id = 0)
+		: _name (name)
+		, _id (id)
+	{
+		CycleTrace::begin (_name, _id);
+	}
+
+	~CycleTraceScope ()
+	{
+		CycleTrace::end (_name, _id);
+	}
+
+private:
+	const char* _name;
+	uint64_t    _id;
+};
+
+} // namespace PBD
+
+#endif /* __libpbd_cycle_trace_h__ */
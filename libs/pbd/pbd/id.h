@@ -62,6 +62,7 @@ class LIBPBD_API ID {
 	}
 
 	std::string to_s () const;
+	uint64_t get_id () const { return _id; }
 
 	static uint64_t counter() { return _counter; }
 	static void init_counter (uint64_t val) { _counter = val; }
@@ -168,6 +168,12 @@ public:
 		return *node;
 	}
 
+	size_t memory_used () {
+		return sizeof (*this)
+			+ (before ? before->memory_used () : 0)
+			+ (after ? after->memory_used () : 0);
+	}
+
 protected:
 	MementoCommandBinder<obj_T>* _binder;
 	XMLNode* before;
@@ -0,0 +1,112 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef __libpbd_triple_buffer_h__
+#define __libpbd_triple_buffer_h__
+
+#include <glib.h>
+
+#include "pbd/libpbd_visibility.h"
+
+namespace PBD {
+
+/** Lock-free exchange of the most recent value between one writer and
+ * one reader, neither of which ever waits for the other.
+ *
+ * The writer fills write_buffer() and calls publish(). The reader calls
+ * fetch() to get the most recently published value, which stays valid
+ * (and unchanged) until the next call of fetch(). Values that are
+ * published while the reader is not looking are overwritten.
+ *
+ * Both sides may read and modify their own buffer, but resizing buffers
+ * (e.g. if T is a container) must only be done while neither side is
+ * active, see for_each().
+ */
+template<class T>
+class /*LIBPBD_API*/ TripleBuffer
+{
+public:
+	TripleBuffer ()
+		: _write (0)
+		, _shared (1)
+		, _read (2)
+	{}
+
+	/** the buffer owned by the writer */
+	T& write_buffer () { return _buf[_write]; }
+
+	/** make the writer's buffer available to the reader,
+	 * the writer continues with an unused buffer.
+	 */
+	void publish () {
+		const gint w = _write | fresh;
+		gint s;
+		do {
+			s = g_atomic_int_get (&_shared);
+		} while (!g_atomic_int_compare_and_exchange (&_shared, s, w));
+		_write = s & index_mask;
+	}
+
+	/** @return true if the reader would get a new value from fetch() */
+	bool available () const {
+		return g_atomic_int_get (const_cast<volatile gint*> (&_shared)) & fresh;
+	}
+
+	/** @return the most recently published value.
+	 * @param is_new set to true if the value was published since the
+	 * previous call.
+	 */
+	T const& fetch (bool* is_new = 0) {
+		const bool n = available ();
+		if (n) {
+			gint s;
+			do {
+				s = g_atomic_int_get (&_shared);
+			} while (!g_atomic_int_compare_and_exchange (&_shared, s, _read));
+			_read = s & index_mask;
+		}
+		if (is_new) {
+			*is_new = n;
+		}
+		return _buf[_read];
+	}
+
+	/** apply @a f to all three buffers, e.g. to resize them.
+	 * Not thread safe: neither the reader nor the writer must be active.
+	 */
+	template<typename F>
+	void for_each (F f) {
+		for (int i = 0; i < 3; ++i) {
+			f (_buf[i]);
+		}
+	}
+
+private:
+	TripleBuffer (TripleBuffer const&);
+	TripleBuffer& operator= (TripleBuffer const&);
+
+	static const gint index_mask = 0x3;
+	static const gint fresh = 0x4;
+
+	T             _buf[3];
+	gint          _write;  ///< owned by the writer
+	volatile gint _shared; ///< index of the buffer in between, and the fresh flag
+	gint          _read;   ///< owned by the reader
+};
+
+} // namespace PBD
+
+#endif /* __libpbd_triple_buffer_h__ */
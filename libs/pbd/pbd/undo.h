@@ -64,6 +64,11 @@ public:
 
 	XMLNode& get_state ();
 
+	/** @return approximate number of bytes retained by all commands,
+	 * computed once and cached until the transaction changes.
+	 */
+	size_t memory_used ();
+
 	void set_timestamp (struct timeval& t)
 	{
 		_timestamp = t;
@@ -78,6 +83,7 @@ private:
 	std::list<Command*> actions;
 	struct timeval      _timestamp;
 	bool                _clearing;
+	size_t              _memory_used;
 
 	void about_to_explicitly_delete ();
 };
@@ -127,6 +133,20 @@ public:
 
 	void set_depth (uint32_t);
 
+	/** Limit the memory retained by the undo list. Old transactions are
+	 * dropped once @param bytes is exceeded; the most recent transaction
+	 * is always kept. 0 means unlimited.
+	 */
+	void set_memory_limit (size_t bytes);
+
+	/** @return approximate number of bytes retained by undo and redo lists */
+	size_t memory_used () const;
+
+	/** @return a counter that changes whenever the history changes,
+	 * e.g. to skip saving unchanged history.
+	 */
+	uint64_t generation () const { return _generation; }
+
 	PBD::Signal0<void> Changed;
 	PBD::Signal0<void> BeginUndoRedo;
 	PBD::Signal0<void> EndUndoRedo;
@@ -134,10 +154,14 @@ public:
 private:
 	bool                        _clearing;
 	uint32_t                    _depth;
+	size_t                      _memory_limit;
+	uint64_t                    _generation;
 	std::list<UndoTransaction*> UndoList;
 	std::list<UndoTransaction*> RedoList;
 
 	void remove (UndoTransaction*);
+	void trim_to_memory_limit ();
+	void changed ();
 };
 
 #endif /* __lib_pbd_undo_h__ */
@@ -54,13 +54,23 @@ public:
 	XMLProperty(const std::string& n, const std::string& v = std::string());
 	~XMLProperty();
 
-	const std::string& name() const { return _name; }
+	const std::string& name() const { return *_name; }
 	const std::string& value() const { return _value; }
 	const std::string& set_value(const std::string& v) { return _value = v; }
 
+	/** @return a pointer to the process-wide, shared copy of @param n.
+	 * Property names are interned, so that names of equal properties
+	 * share storage and can be compared by address.
+	 */
+	static std::string const* intern (const std::string& n);
+
 private:
-	std::string _name;
-	std::string _value;
+	friend class XMLNode;
+
+	XMLProperty(std::string const* interned_name, const std::string& v);
+
+	std::string const* _name;
+	std::string        _value;
 };
 
 typedef std::vector<XMLNode *>                   XMLNodeList;
@@ -87,6 +97,15 @@ public:
 	int compression() const { return _compression; }
 	int set_compression(int);
 
+	/** If set, write() uses a compact binary encoding of the node tree
+	 * instead of XML. read() detects the format automatically.
+	 */
+	bool binary() const { return _binary; }
+	void set_binary (bool yn) { _binary = yn; }
+
+	/** @return true if the file at @param fn uses the binary encoding */
+	static bool is_binary_file (const std::string& fn);
+
 	bool read() { return read_internal(false); }
 	bool read(const std::string& fn) { set_filename(fn); return read_internal(false); }
 	bool read_and_validate() { return read_internal(true); }
@@ -104,11 +123,15 @@ public:
 
 private:
 	bool read_internal(bool validate);
+	bool read_sax();
+	bool read_binary();
+	bool write_binary() const;
 
 	std::string _filename;
 	XMLNode*    _root;
-	xmlDocPtr   _doc;
+	mutable xmlDocPtr _doc;
 	int         _compression;
+	bool        _binary;
 };
 
 class LIBPBD_API XMLNode {
@@ -194,6 +217,11 @@ public:
 
 	void dump (std::ostream &, std::string p = "") const;
 
+	/** @return approximate heap size of this node and all its children, in bytes.
+	 * Interned property names are not included.
+	 */
+	size_t memory_used () const;
+
 private:
 	std::string         _name;
 	bool                _is_content;
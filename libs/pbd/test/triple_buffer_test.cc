@@ -0,0 +1,99 @@
+#include <glibmm/threads.h>
+
+#include "triple_buffer_test.h"
+#include "pbd/triple_buffer.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (TripleBufferTest);
+
+using namespace std;
+
+static void
+zero (int& i)
+{
+	i = 0;
+}
+
+void
+TripleBufferTest::testBasic ()
+{
+	PBD::TripleBuffer<int> tb;
+	bool is_new;
+
+	tb.for_each (zero);
+
+	CPPUNIT_ASSERT (!tb.available ());
+	CPPUNIT_ASSERT_EQUAL (0, tb.fetch (&is_new));
+	CPPUNIT_ASSERT (!is_new);
+
+	tb.write_buffer () = 1;
+	tb.publish ();
+	CPPUNIT_ASSERT (tb.available ());
+	CPPUNIT_ASSERT_EQUAL (1, tb.fetch (&is_new));
+	CPPUNIT_ASSERT (is_new);
+
+	/* the value stays until something new is published */
+	CPPUNIT_ASSERT_EQUAL (1, tb.fetch (&is_new));
+	CPPUNIT_ASSERT (!is_new);
+
+	/* the reader only sees the most recent value */
+	tb.write_buffer () = 2;
+	tb.publish ();
+	tb.write_buffer () = 3;
+	tb.publish ();
+	CPPUNIT_ASSERT_EQUAL (3, tb.fetch (&is_new));
+	CPPUNIT_ASSERT (is_new);
+	CPPUNIT_ASSERT (!tb.available ());
+}
+
+namespace {
+
+struct Pair {
+	int a;
+	int b;
+};
+
+struct Shared {
+	PBD::TripleBuffer<Pair> tb;
+	volatile gint done;
+};
+
+}
+
+static void
+writer (Shared* s)
+{
+	for (int i = 1; i <= 100000; ++i) {
+		Pair& p (s->tb.write_buffer ());
+		p.a = i;
+		p.b = -i;
+		s->tb.publish ();
+	}
+	g_atomic_int_set (&s->done, 1);
+}
+
+void
+TripleBufferTest::testThreaded ()
+{
+	Shared s;
+	s.done = 0;
+	s.tb.write_buffer ().a = s.tb.write_buffer ().b = 0;
+	s.tb.publish ();
+
+	Glib::Threads::Thread* t = Glib::Threads::Thread::create (sigc::bind (sigc::ptr_fun (writer), &s));
+
+	int last = 0;
+	bool finished = false;
+
+	while (!finished) {
+		finished = g_atomic_int_get (&s.done);
+		Pair const& p (s.tb.fetch ());
+		/* never a torn value, and never going back in time */
+		CPPUNIT_ASSERT_EQUAL (p.a, -p.b);
+		CPPUNIT_ASSERT (p.a >= last);
+		last = p.a;
+	}
+
+	t->join ();
+
+	CPPUNIT_ASSERT_EQUAL (100000, s.tb.fetch ().a);
+}
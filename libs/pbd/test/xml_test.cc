@@ -218,7 +218,8 @@ static const uint32_t test_iterations = 10;
 
 void
 test_xml_document (const std::string& test_name,
-                   std::vector<NodeOptions>& node_options)
+                   std::vector<NodeOptions>& node_options,
+                   bool binary = false)
 {
 	const string test_output_dir = test_output_directory (test_name);
 
@@ -238,6 +239,7 @@ test_xml_document (const std::string& test_name,
 		XMLTree test_xml;
 
 		CPPUNIT_ASSERT (create_xml_doc (test_xml, node_options));
+		test_xml.set_binary (binary);
 
 		create_timing_data.add_elapsed ();
 
@@ -257,6 +259,7 @@ test_xml_document (const std::string& test_name,
 
 		// check that what we have read is identical to what was written
 		CPPUNIT_ASSERT (*read_doc.root() == *test_xml.root());
+		CPPUNIT_ASSERT (XMLTree::is_binary_file (output_file_path) == binary);
 
 		// These files are too big to keep around
 		CPPUNIT_ASSERT (g_remove (output_file_path.c_str ()) == 0);
@@ -304,3 +307,81 @@ XMLTest::testPerfLargeXMLDocument ()
 
 	test_xml_document ("testPerfLargeXMLDocument", node_options);
 }
+
+void
+XMLTest::testPerfLargeBinaryDocument ()
+{
+	std::vector<NodeOptions> node_options;
+
+	// Same as testPerfLargeXMLDocument, using the binary encoding
+	node_options.push_back (NodeOptions (child_node_name, 32, 2));
+	node_options.push_back (NodeOptions (grandchild_node_name, 128, 16, get_event_content (32)));
+	node_options.push_back (NodeOptions (great_grandchild_node_name, 16, 8));
+
+	test_xml_document ("testPerfLargeBinaryDocument", node_options, true);
+}
+
+void
+XMLTest::testBinaryRoundTrip ()
+{
+	std::vector<NodeOptions> node_options;
+
+	node_options.push_back (NodeOptions (child_node_name, 8, 4));
+	node_options.push_back (NodeOptions (grandchild_node_name, 4, 16, get_event_content (4)));
+
+	const string test_output_dir = test_output_directory ("testBinaryRoundTrip");
+	const string xml_path = Glib::build_filename (test_output_dir, "original.xml");
+	const string bin_path = Glib::build_filename (test_output_dir, "converted.bin");
+	const string xml2_path = Glib::build_filename (test_output_dir, "converted.xml");
+
+	XMLTree original;
+	CPPUNIT_ASSERT (create_xml_doc (original, node_options));
+	original.root()->set_property ("escaped", "<a & \"b\">");
+	CPPUNIT_ASSERT (original.write (xml_path));
+
+	/* XML -> binary */
+	XMLTree from_xml (xml_path);
+	from_xml.set_binary (true);
+	CPPUNIT_ASSERT (from_xml.write (bin_path));
+	CPPUNIT_ASSERT (XMLTree::is_binary_file (bin_path));
+	CPPUNIT_ASSERT (!XMLTree::is_binary_file (xml_path));
+
+	/* binary -> XML */
+	XMLTree from_bin (bin_path);
+	CPPUNIT_ASSERT (from_bin.root ());
+	CPPUNIT_ASSERT (*from_bin.root () == *original.root ());
+	from_bin.set_binary (false);
+	CPPUNIT_ASSERT (from_bin.write (xml2_path));
+
+	CPPUNIT_ASSERT (Glib::file_get_contents (xml_path) == Glib::file_get_contents (xml2_path));
+}
+
+void
+XMLTest::testDirectParser ()
+{
+	const char* files[] = { "TestSession.ardour", "ProtoolsPatchFile.midnam", "RosegardenPatchFile.xml" };
+
+	for (size_t i = 0; i < sizeof (files) / sizeof (files[0]); ++i) {
+		std::string path;
+		CPPUNIT_ASSERT (find_file (test_search_path (), files[i], path));
+
+		/* read() builds the tree directly from SAX callbacks,
+		 * read_buffer() still goes through a libxml2 document */
+		XMLTree direct (path);
+		CPPUNIT_ASSERT (direct.root ());
+
+		xmlKeepBlanksDefault (0);
+		XMLTree dom;
+		CPPUNIT_ASSERT (dom.read_buffer (Glib::file_get_contents (path)));
+
+		CPPUNIT_ASSERT (*direct.root () == *dom.root ());
+	}
+
+	/* property names are shared */
+	XMLNode a ("A");
+	XMLNode b ("B");
+	a.set_property ("name", "a");
+	b.set_property ("name", "b");
+	CPPUNIT_ASSERT (&a.property ("name")->name () == &b.property ("name")->name ());
+	CPPUNIT_ASSERT (b.property (a.property ("name")->name ())->value () == "b");
+}
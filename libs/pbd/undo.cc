@@ -21,10 +21,13 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <time.h>
 
+#include "pbd/compose.h"
+#include "pbd/debug.h"
 #include "pbd/undo.h"
 #include "pbd/xml++.h"
 
@@ -33,6 +36,7 @@ using namespace sigc;
 
 UndoTransaction::UndoTransaction ()
 	: _clearing (false)
+	, _memory_used (0)
 {
 	gettimeofday (&_timestamp, 0);
 }
@@ -40,6 +44,7 @@ UndoTransaction::UndoTransaction ()
 UndoTransaction::UndoTransaction (const UndoTransaction& rhs)
 	: Command (rhs._name)
 	, _clearing (false)
+	, _memory_used (0)
 {
 	_timestamp = rhs._timestamp;
 	clear ();
@@ -75,6 +80,7 @@ UndoTransaction::operator= (const UndoTransaction& rhs)
 	_name = rhs._name;
 	clear ();
 	actions.insert (actions.end (), rhs.actions.begin (), rhs.actions.end ());
+	_memory_used = rhs._memory_used;
 	return *this;
 }
 
@@ -88,6 +94,7 @@ UndoTransaction::add_command (Command* const cmd)
 
 	cmd->DropReferences.connect_same_thread (*this, boost::bind (&command_death, this, cmd));
 	actions.push_back (cmd);
+	_memory_used = 0;
 }
 
 void
@@ -99,6 +106,7 @@ UndoTransaction::remove_command (Command* const action)
 	}
 	actions.erase (i);
 	delete action;
+	_memory_used = 0;
 }
 
 bool
@@ -115,6 +123,7 @@ UndoTransaction::clear ()
 		delete *i;
 	}
 	actions.clear ();
+	_memory_used = 0;
 	_clearing = false;
 }
 
@@ -156,6 +165,18 @@ UndoTransaction::get_state ()
 	return *node;
 }
 
+size_t
+UndoTransaction::memory_used ()
+{
+	if (_memory_used == 0) {
+		_memory_used = sizeof (*this);
+		for (list<Command*>::iterator i = actions.begin (); i != actions.end (); ++i) {
+			_memory_used += (*i)->memory_used ();
+		}
+	}
+	return _memory_used;
+}
+
 class UndoRedoSignaller
 {
 public:
@@ -176,8 +197,56 @@ private:
 
 UndoHistory::UndoHistory ()
 {
-	_clearing = false;
-	_depth    = 0;
+	_clearing     = false;
+	_depth        = 0;
+	_memory_limit = 0;
+	_generation   = 0;
+}
+
+void
+UndoHistory::changed ()
+{
+	++_generation;
+	Changed (); /* EMIT SIGNAL */
+}
+
+size_t
+UndoHistory::memory_used () const
+{
+	size_t bytes = 0;
+	for (std::list<UndoTransaction*>::const_iterator i = UndoList.begin (); i != UndoList.end (); ++i) {
+		bytes += (*i)->memory_used ();
+	}
+	for (std::list<UndoTransaction*>::const_iterator i = RedoList.begin (); i != RedoList.end (); ++i) {
+		bytes += (*i)->memory_used ();
+	}
+	return bytes;
+}
+
+void
+UndoHistory::set_memory_limit (size_t bytes)
+{
+	_memory_limit = bytes;
+	trim_to_memory_limit ();
+}
+
+void
+UndoHistory::trim_to_memory_limit ()
+{
+	if (_memory_limit == 0) {
+		return;
+	}
+
+	size_t bytes = memory_used ();
+
+	while (bytes > _memory_limit && UndoList.size () > 1) {
+		UndoTransaction* ut = UndoList.front ();
+		UndoList.pop_front ();
+		bytes -= std::min (bytes, ut->memory_used ());
+		DEBUG_TRACE (PBD::DEBUG::UndoHistory, string_compose ("drop '%1' (%2 bytes) to stay within %3 bytes\n", ut->name (), ut->memory_used (), _memory_limit));
+		delete ut;
+		++_generation;
+	}
 }
 
 void
@@ -200,6 +269,7 @@ UndoHistory::set_depth (uint32_t d)
 			UndoList.pop_front ();
 			delete ut;
 		}
+		++_generation;
 	}
 }
 
@@ -235,9 +305,14 @@ UndoHistory::add (UndoTransaction* const ut)
 	RedoList.clear ();
 	_clearing = false;
 
+	DEBUG_TRACE (PBD::DEBUG::UndoHistory, string_compose ("add '%1' retaining %2 bytes, history: %3 transactions, %4 bytes\n",
+	                                                      ut->name (), ut->memory_used (), UndoList.size (), memory_used ()));
+
+	trim_to_memory_limit ();
+
 	/* we are now owners of the transaction and must delete it when finished with it */
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 void
@@ -250,7 +325,7 @@ UndoHistory::remove (UndoTransaction* const ut)
 	UndoList.remove (ut);
 	RedoList.remove (ut);
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 /** Undo some transactions.
@@ -277,7 +352,7 @@ UndoHistory::undo (unsigned int n)
 		}
 	}
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 void
@@ -301,7 +376,7 @@ UndoHistory::redo (unsigned int n)
 		}
 	}
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 void
@@ -314,7 +389,7 @@ UndoHistory::clear_redo ()
 	RedoList.clear ();
 	_clearing = false;
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 void
@@ -327,7 +402,7 @@ UndoHistory::clear_undo ()
 	UndoList.clear ();
 	_clearing = false;
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 void
@@ -336,7 +411,7 @@ UndoHistory::clear ()
 	clear_undo ();
 	clear_redo ();
 
-	Changed (); /* EMIT SIGNAL */
+	changed ();
 }
 
 XMLNode&
@@ -6,7 +6,14 @@
  */
 
 #include <iostream>
+#include <map>
+#include <set>
+#include <cstring>
 
+#include <glib.h>
+#include <glibmm/threads.h>
+
+#include "pbd/gstdio_compat.h"
 #include "pbd/stacktrace.h"
 #include "pbd/xml++.h"
 
@@ -27,6 +34,7 @@ XMLTree::XMLTree()
 	, _root(0)
 	, _doc (0)
 	, _compression(0)
+	, _binary(false)
 {
 }
 
@@ -35,6 +43,7 @@ XMLTree::XMLTree(const string& fn, bool validate)
 	, _root(0)
 	, _doc (0)
 	, _compression(0)
+	, _binary(false)
 {
 	read_internal(validate);
 }
@@ -44,6 +53,7 @@ XMLTree::XMLTree(const XMLTree* from)
 	, _root(new XMLNode(*from->root()))
 	, _doc (xmlCopyDoc (from->_doc, 1))
 	, _compression(from->compression())
+	, _binary(from->binary())
 {
 
 }
@@ -85,6 +95,14 @@ XMLTree::read_internal(bool validate)
 		_doc = 0;
 	}
 
+	if (is_binary_file (_filename)) {
+		return read_binary ();
+	}
+
+	if (!validate) {
+		return read_sax ();
+	}
+
 	/* Calling this prevents libxml2 from treating whitespace as active
 	   nodes. It needs to be called before we create a parser context.
 	*/
@@ -159,6 +177,10 @@ XMLTree::write() const
 	XMLNodeList children;
 	int result;
 
+	if (_binary) {
+		return write_binary ();
+	}
+
 	xmlKeepBlanksDefault(0);
 	doc = xmlNewDoc(xml_version);
 	xmlSetDocCompressMode(doc, _compression);
@@ -289,8 +311,9 @@ XMLNode::operator= (const XMLNode& from)
 
 	const XMLPropertyList& props = from.properties ();
 
+	/* property names are unique within @param from, no need to look them up */
 	for (XMLPropertyConstIterator prop_iter = props.begin (); prop_iter != props.end (); ++prop_iter) {
-		set_property ((*prop_iter)->name ().c_str (), (*prop_iter)->value ());
+		_proplist.push_back (new XMLProperty ((*prop_iter)->_name, (*prop_iter)->value ()));
 	}
 
 	const XMLNodeList& nodes = from.children ();
@@ -330,7 +353,7 @@ XMLNode::operator== (const XMLNode& other) const
 	while (our_prop_iter != _proplist.end ()) {
 		XMLProperty const* our_prop = *our_prop_iter;
 		XMLProperty const* other_prop = *other_prop_iter;
-		if (our_prop->name () != other_prop->name () || our_prop->value () != other_prop->value ()) {
+		if (our_prop->_name != other_prop->_name || our_prop->value () != other_prop->value ()) {
 			return false;
 		}
 		++our_prop_iter;
@@ -424,7 +447,9 @@ XMLNode::children(const string& n) const
 XMLNode*
 XMLNode::add_child(const char* n)
 {
-	return add_child_copy(XMLNode (n));
+	XMLNode* child = new XMLNode (n);
+	_children.push_back (child);
+	return child;
 }
 
 void
@@ -447,6 +472,16 @@ XMLTree::find(const string xpath, XMLNode* node) const
 	xmlXPathContext* ctxt;
 	xmlDocPtr doc = 0;
 
+	if (!node && !_doc) {
+		/* trees read by read_sax() have no libxml2 document,
+		 * build one on first use and keep it like read() used to */
+		if (!_root) {
+			return boost::shared_ptr<XMLSharedNodeList> (new XMLSharedNodeList);
+		}
+		_doc = xmlNewDoc(xml_version);
+		writenode(_doc, _root, _doc->children, 1);
+	}
+
 	if (node) {
 		doc = xmlNewDoc(xml_version);
 		writenode(doc, node, doc->children, 1);
@@ -516,7 +551,8 @@ XMLNode::property(const string& name) const
 	XMLPropertyConstIterator iter = _proplist.begin();
 
 	while (iter != _proplist.end()) {
-		if ((*iter)->name() == name) {
+		/* interned names, e.g. (*i)->name() of another node, match by address */
+		if ((*iter)->_name == &name || (*iter)->name() == name) {
 			return *iter;
 		}
 		++iter;
@@ -690,15 +726,266 @@ XMLNode::remove_node_and_delete(const string& n, const string& propname, const s
 }
 
 XMLProperty::XMLProperty(const string& n, const string& v)
-	: _name(n)
+	: _name(intern (n))
+	, _value(v)
+{
+}
+
+XMLProperty::XMLProperty(string const* interned_name, const string& v)
+	: _name(interned_name)
 	, _value(v)
 {
 }
 
+string const*
+XMLProperty::intern (const string& n)
+{
+	/* The set of distinct property names is small and bounded, while
+	 * sessions, undo history and presets hold millions of properties.
+	 * Entries are never removed, and the pool is intentionally leaked
+	 * so that it outlives any static XMLNode.
+	 */
+	static Glib::Threads::Mutex* lock = new Glib::Threads::Mutex;
+	static std::set<string>*     pool = new std::set<string>;
+
+	Glib::Threads::Mutex::Lock lm (*lock);
+	return &(*pool->insert (n).first);
+}
+
 XMLProperty::~XMLProperty()
 {
 }
 
+/* Direct (SAX2) parser
+ *
+ * Builds the XMLNode tree straight from parser callbacks, without a
+ * libxml2 document in between. The resulting tree is identical to the
+ * one produced by readnode() from a document parsed with blanks
+ * removed: text is coalesced into "text" content nodes, comments become
+ * "comment" content nodes and CDATA sections unnamed content nodes.
+ */
+
+namespace {
+
+struct SAXBuilder {
+	SAXBuilder () : root (0) {}
+
+	~SAXBuilder () {
+		if (stack.empty ()) {
+			return;
+		}
+		/* parse error: drop the partial tree */
+		delete stack.front ();
+	}
+
+	std::vector<XMLNode*> stack;
+	/* per element whitespace state, mirrors libxml2's ctxt->space:
+	 * 1: xml:space="preserve", -1: default, -2: mixed content
+	 */
+	std::vector<int>      space;
+	XMLNode*              root;
+	std::string           text;
+};
+
+}
+
+static bool
+sax_is_blank (const std::string& str)
+{
+	for (std::string::const_iterator i = str.begin (); i != str.end (); ++i) {
+		if (*i != ' ' && *i != '\t' && *i != '\n' && *i != '\r') {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool
+sax_is_text (XMLNode const* node)
+{
+	return node->is_content () && node->name () == "text";
+}
+
+static void
+sax_add_content (SAXBuilder* b, const std::string& name, const std::string& content)
+{
+	if (b->stack.empty ()) {
+		return;
+	}
+	XMLNode* n = new XMLNode (name);
+	n->set_content (content);
+	b->stack.back ()->add_child_nocopy (*n);
+}
+
+/** Flush accumulated character data. Like libxml2's areBlanks(),
+ * whitespace-only text is ignorable unless it is the only content
+ * of an element, or the element already has mixed content.
+ */
+static void
+sax_flush_text (SAXBuilder* b, bool closing)
+{
+	if (b->text.empty ()) {
+		return;
+	}
+
+	if (b->stack.empty ()) {
+		b->text.clear ();
+		return;
+	}
+
+	int& space = b->space.back ();
+	XMLNodeList const& siblings = b->stack.back ()->children ();
+
+	if (space == 1 || space == -2 || !sax_is_blank (b->text)
+	    || (closing && siblings.empty ())
+	    || (!siblings.empty () && (sax_is_text (siblings.front ()) || sax_is_text (siblings.back ())))) {
+		sax_add_content (b, "text", b->text);
+		/* libxml2 only flags the element when the (ASCII) text run
+		 * begins with whitespace, follow it to yield the same tree */
+		if (space == -1 && sax_is_blank (b->text.substr (0, 1))) {
+			space = -2;
+		}
+	}
+
+	b->text.clear ();
+}
+
+static void
+sax_start_element (void* ctx, const xmlChar* localname, const xmlChar*, const xmlChar*,
+                   int, const xmlChar**, int nb_attributes, int, const xmlChar** attributes)
+{
+	SAXBuilder* b = static_cast<SAXBuilder*> (static_cast<xmlParserCtxtPtr> (ctx)->_private);
+
+	sax_flush_text (b, false);
+
+	XMLNode* n = new XMLNode ((const char*) localname);
+
+	int space = (b->space.empty () || b->space.back () == -2) ? -1 : b->space.back ();
+
+	/* attributes are (localname, prefix, URI, value, end) tuples */
+	for (int i = 0; i < nb_attributes; ++i) {
+		const xmlChar** a = &attributes[i * 5];
+		std::string value ((const char*) a[3], a[4] - a[3]);
+
+		if (a[1] && !strcmp ((const char*) a[1], "xml") && !strcmp ((const char*) a[0], "space")) {
+			if (value == "preserve") {
+				space = 1;
+			} else if (value == "default") {
+				space = 0;
+			}
+		}
+
+		/* without entity substitution, libxml2 passes '&' as "&#38;" */
+		std::string::size_type pos = 0;
+		while ((pos = value.find ("&#38;", pos)) != std::string::npos) {
+			value.replace (pos, 5, "&");
+			++pos;
+		}
+
+		n->set_property ((const char*) a[0], value);
+	}
+
+	if (b->stack.empty ()) {
+		if (b->root) {
+			/* not well-formed, libxml2 reports this as an error */
+			delete n;
+			return;
+		}
+		b->root = n;
+	} else {
+		b->stack.back ()->add_child_nocopy (*n);
+	}
+
+	b->stack.push_back (n);
+	b->space.push_back (space);
+}
+
+static void
+sax_end_element (void* ctx, const xmlChar*, const xmlChar*, const xmlChar*)
+{
+	SAXBuilder* b = static_cast<SAXBuilder*> (static_cast<xmlParserCtxtPtr> (ctx)->_private);
+
+	sax_flush_text (b, true);
+
+	if (!b->stack.empty ()) {
+		b->stack.pop_back ();
+		b->space.pop_back ();
+	}
+}
+
+static void
+sax_characters (void* ctx, const xmlChar* ch, int len)
+{
+	SAXBuilder* b = static_cast<SAXBuilder*> (static_cast<xmlParserCtxtPtr> (ctx)->_private);
+	b->text.append ((const char*) ch, len);
+}
+
+static void
+sax_cdata (void* ctx, const xmlChar* ch, int len)
+{
+	SAXBuilder* b = static_cast<SAXBuilder*> (static_cast<xmlParserCtxtPtr> (ctx)->_private);
+	sax_flush_text (b, false);
+	sax_add_content (b, std::string (), std::string ((const char*) ch, len));
+}
+
+static void
+sax_comment (void* ctx, const xmlChar* value)
+{
+	SAXBuilder* b = static_cast<SAXBuilder*> (static_cast<xmlParserCtxtPtr> (ctx)->_private);
+	sax_flush_text (b, false);
+	sax_add_content (b, "comment", (const char*) value);
+}
+
+static void
+sax_processing_instruction (void* ctx, const xmlChar* target, const xmlChar* data)
+{
+	SAXBuilder* b = static_cast<SAXBuilder*> (static_cast<xmlParserCtxtPtr> (ctx)->_private);
+	sax_flush_text (b, false);
+	sax_add_content (b, (const char*) target, data ? (const char*) data : "");
+}
+
+bool
+XMLTree::read_sax ()
+{
+	xmlParserCtxtPtr ctxt = xmlNewParserCtxt ();
+	if (ctxt == NULL) {
+		return false;
+	}
+
+	/* keep the default SAX2 handlers for everything else (document,
+	 * DTD, entities, errors), they all expect the parser context */
+	ctxt->sax->startElementNs = sax_start_element;
+	ctxt->sax->endElementNs   = sax_end_element;
+	ctxt->sax->characters     = sax_characters;
+	ctxt->sax->cdataBlock     = sax_cdata;
+	ctxt->sax->comment        = sax_comment;
+	ctxt->sax->processingInstruction = sax_processing_instruction;
+
+	SAXBuilder builder;
+	ctxt->_private = &builder;
+
+	xmlDocPtr doc = xmlCtxtReadFile (ctxt, _filename.c_str(), NULL, XML_PARSE_HUGE | XML_PARSE_NOBLANKS);
+
+	bool const ok = doc && ctxt->wellFormed && builder.root && builder.stack.empty ();
+
+	if (doc) {
+		/* only holds the XML declaration and DTD, if any */
+		xmlFreeDoc (doc);
+	}
+
+	xmlFreeParserCtxt (ctxt);
+
+	if (!ok) {
+		if (builder.stack.empty ()) {
+			delete builder.root;
+		}
+		return false;
+	}
+
+	_root = builder.root;
+	return true;
+}
+
 static XMLNode*
 readnode(xmlNodePtr node)
 {
@@ -820,3 +1107,300 @@ XMLNode::dump (ostream& s, string p) const
 		s << p << "</" << _name << ">\n";
 	}
 }
+
+size_t
+XMLNode::memory_used () const
+{
+	size_t bytes = sizeof (XMLNode) + _name.size () + _content.size ();
+
+	bytes += _proplist.capacity () * sizeof (XMLProperty*);
+	for (XMLPropertyList::const_iterator i = _proplist.begin(); i != _proplist.end(); ++i) {
+		bytes += sizeof (XMLProperty) + (*i)->value().size ();
+	}
+
+	for (XMLNodeList::const_iterator i = _children.begin(); i != _children.end(); ++i) {
+		bytes += sizeof (XMLNode*) + (*i)->memory_used ();
+	}
+
+	return bytes;
+}
+
+/* Binary encoding
+ *
+ * A compact, lossless representation of an XMLNode tree that avoids
+ * libxml2 entirely. All element and property names are stored once in
+ * a string table and referenced by index. Integers use LEB128 varints.
+ *
+ *   magic[8] version[1]
+ *   n_names  { len bytes }*
+ *   node := name-index flags [content] n_props { name-index value }* n_children node*
+ *
+ * The magic starts with a NUL byte, so it can never be mistaken for XML.
+ */
+
+static const char     binary_magic[8]  = { '\0', 'P', 'B', 'D', 'X', 'M', 'L', 'B' };
+static const uint8_t  binary_version   = 1;
+static const uint8_t  binary_is_content = 0x01;
+
+typedef std::map<std::string, uint32_t> BinaryNameMap;
+
+static void
+binary_put_varint (std::string& out, uint64_t v)
+{
+	while (v >= 0x80) {
+		out += (char) ((v & 0x7f) | 0x80);
+		v >>= 7;
+	}
+	out += (char) v;
+}
+
+static void
+binary_put_string (std::string& out, const std::string& str)
+{
+	binary_put_varint (out, str.size ());
+	out += str;
+}
+
+static void
+binary_collect_names (XMLNode const* n, BinaryNameMap& names, std::vector<std::string const*>& table)
+{
+	if (names.insert (make_pair (n->name (), (uint32_t) table.size ())).second) {
+		table.push_back (&n->name ());
+	}
+
+	const XMLPropertyList& props = n->properties ();
+	for (XMLPropertyConstIterator i = props.begin (); i != props.end (); ++i) {
+		if (names.insert (make_pair ((*i)->name (), (uint32_t) table.size ())).second) {
+			table.push_back (&(*i)->name ());
+		}
+	}
+
+	const XMLNodeList& children = n->children ();
+	for (XMLNodeConstIterator i = children.begin (); i != children.end (); ++i) {
+		binary_collect_names (*i, names, table);
+	}
+}
+
+static void
+binary_write_node (std::string& out, XMLNode const* n, BinaryNameMap const& names)
+{
+	binary_put_varint (out, names.find (n->name ())->second);
+
+	out += (char) (n->is_content () ? binary_is_content : 0);
+	if (n->is_content ()) {
+		binary_put_string (out, n->content ());
+	}
+
+	const XMLPropertyList& props = n->properties ();
+	binary_put_varint (out, props.size ());
+	for (XMLPropertyConstIterator i = props.begin (); i != props.end (); ++i) {
+		binary_put_varint (out, names.find ((*i)->name ())->second);
+		binary_put_string (out, (*i)->value ());
+	}
+
+	const XMLNodeList& children = n->children ();
+	binary_put_varint (out, children.size ());
+	for (XMLNodeConstIterator i = children.begin (); i != children.end (); ++i) {
+		binary_write_node (out, *i, names);
+	}
+}
+
+namespace {
+
+struct BinaryReader {
+	BinaryReader (const char* d, size_t len) : data (d), end (d + len), ok (true) {}
+
+	uint64_t varint () {
+		uint64_t v = 0;
+		for (unsigned int shift = 0; shift < 64; shift += 7) {
+			if (data >= end) {
+				ok = false;
+				return 0;
+			}
+			uint8_t const b = (uint8_t) *data++;
+			v |= (uint64_t) (b & 0x7f) << shift;
+			if (!(b & 0x80)) {
+				return v;
+			}
+		}
+		ok = false;
+		return 0;
+	}
+
+	bool str (std::string& s) {
+		uint64_t const len = varint ();
+		if (!ok || len > (uint64_t) (end - data)) {
+			ok = false;
+			return false;
+		}
+		s.assign (data, len);
+		data += len;
+		return true;
+	}
+
+	bool byte (uint8_t& b) {
+		if (data >= end) {
+			ok = false;
+			return false;
+		}
+		b = (uint8_t) *data++;
+		return true;
+	}
+
+	const char* data;
+	const char* end;
+	bool ok;
+};
+
+}
+
+static XMLNode*
+binary_read_node (BinaryReader& r, std::vector<std::string> const& names, unsigned int depth)
+{
+	/* guard against corrupt files recursing without bounds */
+	if (depth > 4096) {
+		r.ok = false;
+		return 0;
+	}
+
+	uint64_t const name_idx = r.varint ();
+	uint8_t flags = 0;
+	if (!r.ok || name_idx >= names.size () || !r.byte (flags)) {
+		r.ok = false;
+		return 0;
+	}
+
+	XMLNode* node;
+
+	if (flags & binary_is_content) {
+		std::string content;
+		if (!r.str (content)) {
+			return 0;
+		}
+		node = new XMLNode (names[name_idx], content);
+	} else {
+		node = new XMLNode (names[name_idx]);
+	}
+
+	uint64_t const n_props = r.varint ();
+	std::string value;
+	for (uint64_t i = 0; r.ok && i < n_props; ++i) {
+		uint64_t const prop_idx = r.varint ();
+		if (!r.ok || prop_idx >= names.size () || !r.str (value)) {
+			r.ok = false;
+			break;
+		}
+		node->set_property (names[prop_idx].c_str (), value);
+	}
+
+	uint64_t const n_children = r.ok ? r.varint () : 0;
+	for (uint64_t i = 0; r.ok && i < n_children; ++i) {
+		XMLNode* child = binary_read_node (r, names, depth + 1);
+		if (!child) {
+			break;
+		}
+		node->add_child_nocopy (*child);
+	}
+
+	if (!r.ok) {
+		delete node;
+		return 0;
+	}
+
+	return node;
+}
+
+bool
+XMLTree::is_binary_file (const string& fn)
+{
+	FILE* f = g_fopen (fn.c_str (), "rb");
+	if (!f) {
+		return false;
+	}
+
+	char magic[sizeof (binary_magic)];
+	bool const rv = fread (magic, 1, sizeof (magic), f) == sizeof (magic)
+		&& memcmp (magic, binary_magic, sizeof (magic)) == 0;
+
+	fclose (f);
+	return rv;
+}
+
+bool
+XMLTree::read_binary ()
+{
+	gchar* contents;
+	gsize  length;
+
+	if (!g_file_get_contents (_filename.c_str (), &contents, &length, NULL)) {
+		return false;
+	}
+
+	if (length < sizeof (binary_magic)) {
+		g_free (contents);
+		return false;
+	}
+
+	BinaryReader r (contents + sizeof (binary_magic), length - sizeof (binary_magic));
+
+	uint8_t version = 0;
+	if (!r.byte (version) || version > binary_version) {
+		g_free (contents);
+		return false;
+	}
+
+	uint64_t const n_names = r.varint ();
+	std::vector<std::string> names;
+	if (r.ok && n_names <= length) {
+		names.resize (n_names);
+		for (uint64_t i = 0; r.ok && i < n_names; ++i) {
+			r.str (names[i]);
+		}
+	} else {
+		r.ok = false;
+	}
+
+	if (r.ok) {
+		_root = binary_read_node (r, names, 0);
+	}
+
+	g_free (contents);
+
+	return _root != 0;
+}
+
+bool
+XMLTree::write_binary () const
+{
+	if (!_root) {
+		return false;
+	}
+
+	BinaryNameMap names;
+	std::vector<std::string const*> table;
+	binary_collect_names (_root, names, table);
+
+	std::string out;
+	out.append (binary_magic, sizeof (binary_magic));
+	out += (char) binary_version;
+
+	binary_put_varint (out, table.size ());
+	for (std::vector<std::string const*>::const_iterator i = table.begin (); i != table.end (); ++i) {
+		binary_put_string (out, **i);
+	}
+
+	binary_write_node (out, _root, names);
+
+	FILE* f = g_fopen (_filename.c_str (), "wb");
+	if (!f) {
+		return false;
+	}
+
+	bool const rv = fwrite (out.data (), 1, out.size (), f) == out.size ();
+
+	if (fclose (f) != 0) {
+		return false;
+	}
+
+	return rv;
+}
@@ -118,6 +118,7 @@ OSC::OSC (Session& s, uint32_t port)
 	, bank_dirty (false)
 	, observer_busy (true)
 	, scrub_speed (0)
+	, feedback_interval (20)
 	, gui (0)
 {
 	_instance = this;
@@ -264,6 +265,8 @@ OSC::start ()
 	periodic_connection = periodic_timeout->connect (sigc::mem_fun (*this, &OSC::periodic));
 	periodic_timeout->attach (main_loop()->get_context());
 
+	start_feedback_timer ();
+
 	// catch track reordering
 	// receive routes added
 	session->RouteAdded.connect(session_connections, MISSING_INVALIDATOR, boost::bind (&OSC::notify_routes_added, this, _1), this);
@@ -314,6 +317,7 @@ int
 OSC::stop ()
 {
 	periodic_connection.disconnect ();
+	feedback_connection.disconnect ();
 	session_connections.drop_connections ();
 
 	// clear surfaces
@@ -324,6 +328,10 @@ OSC::stop ()
 	}
 	_surface.clear();
 
+	/* send what the observers queued while going away */
+	flush_feedback ();
+	drop_feedback_queues ();
+
 	/* stop main loop */
 	if (local_server) {
 		g_source_destroy (local_server);
@@ -663,6 +671,9 @@ OSC::register_callbacks()
 		REGISTER_CALLBACK (serv, X_("/strip/plugin/list"), "i", route_plugin_list);
 		REGISTER_CALLBACK (serv, X_("/strip/plugin/descriptor"), "ii", route_plugin_descriptor);
 		REGISTER_CALLBACK (serv, X_("/strip/plugin/reset"), "ii", route_plugin_reset);
+		REGISTER_CALLBACK (serv, X_("/strip/dspload"), "i", route_dspload);
+		REGISTER_CALLBACK (serv, X_("/strip/dspload/reset"), "i", route_dspload_reset);
+		REGISTER_CALLBACK (serv, X_("/strip/plugin/dspload"), "ii", route_plugin_dspload);
 
 		/* still not-really-standardized query interface */
 		//REGISTER_CALLBACK (serv, "/ardour/*/#current_value", "", current_value);
@@ -1350,6 +1361,13 @@ OSC::get_surfaces ()
 		PBD::info << string_compose ("	Expanded flag %1   Track: %2   Jogmode: %3\n", sur->expand_enable, sur->expand, sur->jogmode);
 		PBD::info << string_compose ("	Personal monitor flag %1,   Aux master: %2,   Number of sends: %3\n", sur->cue, sur->aux, sur->sends.size());
 		PBD::info << string_compose ("	Linkset: %1   Device Id: %2\n", sur->linkset, sur->linkid);
+
+		Glib::Threads::Mutex::Lock ll (_lo_lock);
+		FeedbackQueues::const_iterator q = _feedback_queues.find (sur->remote_url);
+		if (q != _feedback_queues.end()) {
+			PBD::info << string_compose ("	Feedback queue depth: %1 (peak %2)   Sent: %3 in %4 bundles   Coalesced: %5\n",
+					q->second.messages.size(), q->second.peak_depth, q->second.sent, q->second.bundles, q->second.coalesced);
+		}
 	}
 	PBD::info << string_compose ("\nList of LinkSets (%1):\n", link_sets.size());
 	std::map<uint32_t, LinkSet>::iterator it;
@@ -5672,6 +5690,96 @@ OSC::route_plugin_reset (int ssid, int piid, lo_message msg) {
 	return 0;
 }
 
+/* DSP load replies are: ssid [piid] min max avg dev, in microseconds per cycle */
+int
+OSC::route_dspload (int ssid, lo_message msg) {
+	if (!session) {
+		return -1;
+	}
+
+	boost::shared_ptr<Route> r = boost::dynamic_pointer_cast<Route>(get_strip (ssid, get_address (msg)));
+
+	if (!r) {
+		PBD::error << "OSC: Invalid Remote Control ID '" << ssid << "'" << endmsg;
+		return -1;
+	}
+
+	uint64_t min, max;
+	double   avg, dev;
+
+	if (!r->get_processor_stats (min, max, avg, dev)) {
+		return 0;
+	}
+
+	lo_message reply = lo_message_new ();
+	lo_message_add_int32 (reply, ssid);
+	lo_message_add_float (reply, min);
+	lo_message_add_float (reply, max);
+	lo_message_add_float (reply, avg);
+	lo_message_add_float (reply, dev);
+
+	lo_send_message (get_address (msg), X_("/strip/dspload"), reply);
+	lo_message_free (reply);
+	return 0;
+}
+
+int
+OSC::route_dspload_reset (int ssid, lo_message msg) {
+	if (!session) {
+		return -1;
+	}
+
+	boost::shared_ptr<Route> r = boost::dynamic_pointer_cast<Route>(get_strip (ssid, get_address (msg)));
+
+	if (!r) {
+		PBD::error << "OSC: Invalid Remote Control ID '" << ssid << "'" << endmsg;
+		return -1;
+	}
+
+	r->clear_processor_stats ();
+	return 0;
+}
+
+int
+OSC::route_plugin_dspload (int ssid, int piid, lo_message msg) {
+	if (!session) {
+		return -1;
+	}
+
+	boost::shared_ptr<Route> r = boost::dynamic_pointer_cast<Route>(get_strip (ssid, get_address (msg)));
+
+	if (!r) {
+		PBD::error << "OSC: Invalid Remote Control ID '" << ssid << "'" << endmsg;
+		return -1;
+	}
+
+	boost::shared_ptr<Processor> redi = r->nth_plugin(piid - 1);
+
+	if (!redi) {
+		PBD::error << "OSC: cannot find plugin # " << piid << " for RID '" << ssid << "'" << endmsg;
+		return -1;
+	}
+
+	uint64_t min, max;
+	double   avg, dev;
+
+	if (!redi->get_stats (min, max, avg, dev)) {
+		return 0;
+	}
+
+	lo_message reply = lo_message_new ();
+	lo_message_add_int32 (reply, ssid);
+	lo_message_add_int32 (reply, piid);
+	lo_message_add_float (reply, min);
+	lo_message_add_float (reply, max);
+	lo_message_add_float (reply, avg);
+	lo_message_add_float (reply, dev);
+
+	lo_send_message (get_address (msg), X_("/strip/plugin/dspload"), reply);
+	lo_message_free (reply);
+	return 0;
+}
+
 int
 OSC::route_plugin_parameter (int ssid, int piid, int par, float val, lo_message msg)
 {
@@ -6240,6 +6348,7 @@ OSC::get_state ()
 	node.set_property (X_("gainmode"), default_gainmode);
 	node.set_property (X_("send-page-size"), default_send_size);
 	node.set_property (X_("plug-page-size"), default_plugin_size);
+	node.set_property (X_("feedback-interval"), feedback_interval);
 	return node;
 }
 
@@ -6262,6 +6371,7 @@ OSC::set_state (const XMLNode& node, int version)
 	node.get_property (X_("gainmode"), default_gainmode);
 	node.get_property (X_("send-page-size"), default_send_size);
 	node.get_property (X_("plugin-page-size"), default_plugin_size);
+	node.get_property (X_("feedback-interval"), feedback_interval);
 
 	global_init = true;
 	tick = false;
@@ -6786,16 +6896,11 @@ OSC::cue_send_enable (uint32_t id, float state, lo_message msg)
 int
 OSC::float_message (string path, float val, lo_address addr)
 {
-	_lo_lock.lock ();
-
 	lo_message reply;
 	reply = lo_message_new ();
 	lo_message_add_float (reply, (float) val);
 
-	lo_send_message (addr, path.c_str(), reply);
-	Glib::usleep(1);
-	lo_message_free (reply);
-	_lo_lock.unlock ();
+	queue_message (path, -1, reply, addr);
 
 	return 0;
 }
@@ -6803,7 +6908,6 @@ OSC::float_message (string path, float val, lo_address addr)
 int
 OSC::float_message_with_id (std::string path, uint32_t ssid, float value, bool in_line, lo_address addr)
 {
-	_lo_lock.lock ();
 	lo_message msg = lo_message_new ();
 	if (in_line) {
 		path = string_compose ("%1/%2", path, ssid);
@@ -6812,26 +6916,18 @@ OSC::float_message_with_id (std::string path, uint32_t ssid, float value, bool i
 	}
 	lo_message_add_float (msg, value);
 
-	lo_send_message (addr, path.c_str(), msg);
-	Glib::usleep(1);
-	lo_message_free (msg);
-	_lo_lock.unlock ();
+	queue_message (path, in_line ? -1 : (int64_t) ssid, msg, addr);
 	return 0;
 }
 
 int
 OSC::int_message (string path, int val, lo_address addr)
 {
-	_lo_lock.lock ();
-
 	lo_message reply;
 	reply = lo_message_new ();
 	lo_message_add_int32 (reply, (float) val);
 
-	lo_send_message (addr, path.c_str(), reply);
-	Glib::usleep(1);
-	lo_message_free (reply);
-	_lo_lock.unlock ();
+	queue_message (path, -1, reply, addr);
 
 	return 0;
 }
@@ -6839,7 +6935,6 @@ OSC::int_message (string path, int val, lo_address addr)
 int
 OSC::int_message_with_id (std::string path, uint32_t ssid, int value, bool in_line, lo_address addr)
 {
-	_lo_lock.lock ();
 	lo_message msg = lo_message_new ();
 	if (in_line) {
 		path = string_compose ("%1/%2", path, ssid);
@@ -6848,26 +6943,18 @@ OSC::int_message_with_id (std::string path, uint32_t ssid, int value, bool in_li
 	}
 	lo_message_add_int32 (msg, value);
 
-	lo_send_message (addr, path.c_str(), msg);
-	Glib::usleep(1);
-	lo_message_free (msg);
-	_lo_lock.unlock ();
+	queue_message (path, in_line ? -1 : (int64_t) ssid, msg, addr);
 	return 0;
 }
 
 int
 OSC::text_message (string path, string val, lo_address addr)
 {
-	_lo_lock.lock ();
-
 	lo_message reply;
 	reply = lo_message_new ();
 	lo_message_add_string (reply, val.c_str());
 
-	lo_send_message (addr, path.c_str(), reply);
-	Glib::usleep(1);
-	lo_message_free (reply);
-	_lo_lock.unlock ();
+	queue_message (path, -1, reply, addr);
 
 	return 0;
 }
@@ -6875,7 +6962,6 @@ OSC::text_message (string path, string val, lo_address addr)
 int
 OSC::text_message_with_id (std::string path, uint32_t ssid, std::string val, bool in_line, lo_address addr)
 {
-	_lo_lock.lock ();
 	lo_message msg = lo_message_new ();
 	if (in_line) {
 		path = string_compose ("%1/%2", path, ssid);
@@ -6885,13 +6971,142 @@ OSC::text_message_with_id (std::string path, uint32_t ssid, std::string val, boo
 
 	lo_message_add_string (msg, val.c_str());
 
-	lo_send_message (addr, path.c_str(), msg);
-	Glib::usleep(1);
-	lo_message_free (msg);
-	_lo_lock.unlock ();
+	queue_message (path, in_line ? -1 : (int64_t) ssid, msg, addr);
 	return 0;
 }
 
+/* takes ownership of msg */
+void
+OSC::queue_message (std::string const& path, int64_t ssid, lo_message msg, lo_address addr)
+{
+	Glib::Threads::Mutex::Lock lm (_lo_lock);
+
+	if (feedback_interval == 0 || !feedback_connection.connected ()) {
+		lo_send_message (addr, path.c_str(), msg);
+		Glib::usleep(1);
+		lo_message_free (msg);
+		return;
+	}
+
+	char* url = lo_address_get_url (addr);
+	FeedbackQueue& q (_feedback_queues[url]);
+	if (!q.addr) {
+		q.addr = lo_address_new_from_url (url);
+	}
+	free (url);
+
+	std::pair<FeedbackQueue::Index::iterator, bool> r = q.index.insert (make_pair (make_pair (path, ssid), q.messages.size ()));
+
+	if (r.second) {
+		q.messages.push_back (make_pair (path, msg));
+		q.peak_depth = max (q.peak_depth, q.messages.size ());
+	} else {
+		/* replace the pending value, keep its place in the queue */
+		lo_message_free (q.messages[r.first->second].second);
+		q.messages[r.first->second].second = msg;
+		++q.coalesced;
+	}
+}
+
+/* bundles are kept below the payload size of a typical ethernet frame,
+ * some surfaces drop larger UDP packets.
+ */
+static const size_t max_bundle_size = 1400;
+
+bool
+OSC::flush_feedback ()
+{
+	Glib::Threads::Mutex::Lock lm (_lo_lock);
+
+	for (FeedbackQueues::iterator i = _feedback_queues.begin(); i != _feedback_queues.end(); ++i) {
+		FeedbackQueue& q (i->second);
+
+		if (q.messages.empty ()) {
+			continue;
+		}
+
+		lo_bundle bundle = 0;
+		size_t size = 0;
+
+		for (FeedbackQueue::Messages::iterator m = q.messages.begin(); m != q.messages.end(); ++m) {
+			const size_t len = lo_message_length (m->second, m->first.c_str());
+
+			if (bundle && size + len > max_bundle_size) {
+				lo_send_bundle (q.addr, bundle);
+				lo_bundle_free (bundle);
+				bundle = 0;
+				++q.bundles;
+			}
+
+			if (!bundle) {
+				bundle = lo_bundle_new (LO_TT_IMMEDIATE);
+				size = 16; // "#bundle" and time tag
+			}
+
+			lo_bundle_add_message (bundle, m->first.c_str(), m->second);
+			size += len + 4;
+			++q.sent;
+		}
+
+		lo_send_bundle (q.addr, bundle);
+		lo_bundle_free (bundle);
+		++q.bundles;
+
+		/* the paths must outlive the bundles */
+		for (FeedbackQueue::Messages::iterator m = q.messages.begin(); m != q.messages.end(); ++m) {
+			lo_message_free (m->second);
+		}
+		q.messages.clear ();
+		q.index.clear ();
+	}
+
+	return true;
+}
+
+void
+OSC::drop_feedback_queues ()
+{
+	Glib::Threads::Mutex::Lock lm (_lo_lock);
+
+	for (FeedbackQueues::iterator i = _feedback_queues.begin(); i != _feedback_queues.end(); ++i) {
+		for (FeedbackQueue::Messages::iterator m = i->second.messages.begin(); m != i->second.messages.end(); ++m) {
+			lo_message_free (m->second);
+		}
+		lo_address_free (i->second.addr);
+	}
+	_feedback_queues.clear ();
+}
+
+/* must be called in the OSC thread */
+void
+OSC::start_feedback_timer ()
+{
+	feedback_connection.disconnect ();
+
+	if (feedback_interval > 0) {
+		Glib::RefPtr<Glib::TimeoutSource> feedback_timeout = Glib::TimeoutSource::create (feedback_interval); // milliseconds
+		feedback_connection = feedback_timeout->connect (sigc::mem_fun (*this, &OSC::flush_feedback));
+		feedback_timeout->attach (main_loop()->get_context());
+	}
+
+	/* anything still queued if we just switched to immediate sending */
+	flush_feedback ();
+}
+
+void
+OSC::set_feedback_interval (uint32_t ms)
+{
+	if (ms == feedback_interval) {
+		return;
+	}
+
+	feedback_interval = ms;
+
+	if (periodic_connection.connected ()) {
+		call_slot (MISSING_INVALIDATOR, boost::bind (&OSC::start_feedback_timer, this));
+	}
+}
+
 // we have to have a sorted list of stripables that have sends pointed at our aux
 // we can use the one in osc.cc to get an aux list
 OSC::Sorted
@@ -28,6 +28,7 @@
 #include <string>
 #include <vector>
 #include <bitset>
+#include <map>
 
 #include <sys/time.h>
 #include <pthread.h>
@@ -256,6 +257,8 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	void set_send_size (int ss) { default_send_size = ss; }
 	int get_plugin_size() { return default_plugin_size; }
 	void set_plugin_size (int ps) { default_plugin_size = ps; }
+	uint32_t get_feedback_interval () { return feedback_interval; }
+	void set_feedback_interval (uint32_t ms);
 	void clear_devices ();
 	void gui_changed ();
 	void get_surfaces ();
@@ -676,6 +679,9 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	PATH_CALLBACK1_MSG(route_plugin_list,i);
 	PATH_CALLBACK2_MSG(route_plugin_descriptor,i,i);
 	PATH_CALLBACK2_MSG(route_plugin_reset,i,i);
+	PATH_CALLBACK1_MSG(route_dspload,i);
+	PATH_CALLBACK1_MSG(route_dspload_reset,i);
+	PATH_CALLBACK2_MSG(route_plugin_dspload,i,i);
 
 	int route_rename (int rid, char *s, lo_message msg);
 	int strip_group (int ssid, char *g, lo_message msg);
@@ -710,6 +716,9 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	int route_plugin_list(int ssid, lo_message msg);
 	int route_plugin_descriptor(int ssid, int piid, lo_message msg);
 	int route_plugin_reset(int ssid, int piid, lo_message msg);
+	int route_dspload(int ssid, lo_message msg);
+	int route_dspload_reset(int ssid, lo_message msg);
+	int route_plugin_dspload(int ssid, int piid, lo_message msg);
 
 	//banking functions
 	int set_bank (uint32_t bank_start, lo_message msg);
@@ -824,6 +833,38 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	int cancel_all_solos ();
 	bool periodic (void);
 	sigc::connection periodic_connection;
+
+	/* Feedback sent via the *_message() calls above is queued per
+	 * remote url and sent as bundles every feedback_interval ms (or
+	 * immediately if it is 0). A message for the same path (and ssid)
+	 * as a queued one replaces it, so a value that changes several
+	 * times between two flushes is only sent once.
+	 */
+	struct FeedbackQueue {
+		FeedbackQueue () : addr (0), peak_depth (0), coalesced (0), sent (0), bundles (0) {}
+
+		typedef std::pair<std::string, int64_t> Key; // path, ssid or -1
+		typedef std::map<Key, size_t> Index;         // index into messages
+		typedef std::vector<std::pair<std::string, lo_message> > Messages;
+
+		lo_address addr;
+		Index      index;
+		Messages   messages;
+		size_t     peak_depth;
+		uint64_t   coalesced;
+		uint64_t   sent;
+		uint64_t   bundles;
+	};
+	typedef std::map<std::string, FeedbackQueue> FeedbackQueues;
+
+	FeedbackQueues _feedback_queues; // protected by _lo_lock
+	uint32_t feedback_interval;      // milliseconds
+	sigc::connection feedback_connection;
+
+	void queue_message (std::string const& path, int64_t ssid, lo_message msg, lo_address addr);
+	void start_feedback_timer ();
+	bool flush_feedback ();
+	void drop_feedback_queues ();
 	PBD::ScopedConnectionList session_connections;
 
 	void debugmsg (const char *prefix, const char *path, const char* types, lo_arg **argv, int argc);
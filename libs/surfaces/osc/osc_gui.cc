@@ -130,6 +130,17 @@ OSC_GUI::OSC_GUI (OSC& p)
 
 	++n;
 
+	// feedback interval setting
+	label = manage (new Gtk::Label(_("Feedback Interval (ms):")));
+	label->set_alignment(1, .5);
+	table->attach (*label, 0, 1, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0));
+	table->attach (feedback_interval_entry, 1, 2, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0), 0, 0);
+	feedback_interval_entry.set_range (0, 1000);
+	feedback_interval_entry.set_increments (5, 20);
+	feedback_interval_entry.set_value (cp.get_feedback_interval());
+
+	++n;
+
 	// Gain Mode
 	label = manage (new Gtk::Label(_("Gain Mode:")));
 	label->set_alignment(1, .5);
@@ -193,6 +204,7 @@ OSC_GUI::OSC_GUI (OSC& p)
 	bank_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::bank_changed));
 	send_page_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::send_page_changed));
 	plugin_page_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::plugin_page_changed));
+	feedback_interval_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::feedback_interval_changed));
 
 	// Strip Types Calculate Page
 	int stn = 0; // table row
@@ -577,6 +589,14 @@ OSC_GUI::plugin_page_changed ()
 
 }
 
+void
+OSC_GUI::feedback_interval_changed ()
+{
+	uint32_t ms = atoi (feedback_interval_entry.get_text ());
+	feedback_interval_entry.set_text (string_compose ("%1", ms));
+	cp.set_feedback_interval (ms);
+}
+
 void
 OSC_GUI::gainmode_changed ()
 {
@@ -636,6 +656,8 @@ OSC_GUI::factory_reset ()
 	send_page_entry.set_text ("0");
 	cp.set_plugin_size (0);
 	plugin_page_entry.set_text ("0");
+	cp.set_feedback_interval (20);
+	feedback_interval_entry.set_text ("20");
 	cp.set_defaultstrip (31);
 	cp.set_defaultfeedback (0);
 	reshow_values ();
@@ -45,6 +45,7 @@ private:
 	Gtk::SpinButton bank_entry;
 	Gtk::SpinButton send_page_entry;
 	Gtk::SpinButton plugin_page_entry;
+	Gtk::SpinButton feedback_interval_entry;
 	Gtk::ComboBoxText gainmode_combo;
 	Gtk::ComboBoxText preset_combo;
 	std::vector<std::string> preset_options;
@@ -75,6 +76,7 @@ private:
 	void bank_changed ();
 	void send_page_changed ();
 	void plugin_page_changed ();
+	void feedback_interval_changed ();
 	void strips_changed ();
 	void feedback_changed ();
 	void preset_changed ();
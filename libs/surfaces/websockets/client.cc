@@ -56,6 +56,80 @@ ClientContext::update_state (const NodeState& node_state)
 	_state.insert (node_state);
 }
 
+bool
+ClientContext::wants (const NodeState& node_state) const
+{
+	/* strip names are always sent, so that clients know which strips
+	 * exist and can subscribe to a different range
+	 */
+	if (node_state.node () == Node::strip_desc) {
+		return true;
+	}
+
+	int n_addr = node_state.n_addr ();
+
+	if (n_addr > 0 && (node_state.nth_addr (0) < _strip_first || node_state.nth_addr (0) > _strip_last)) {
+		return false;
+	}
+
+	if (n_addr > 1 && (node_state.nth_addr (1) < _plugin_first || node_state.nth_addr (1) > _plugin_last)) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+ClientContext::set_range (uint32_t strip_first, uint32_t strip_last,
+                          uint32_t plugin_first, uint32_t plugin_last)
+{
+	_strip_first  = strip_first;
+	_strip_last   = strip_last;
+	_plugin_first = plugin_first;
+	_plugin_last  = plugin_last;
+}
+
+ValueVector
+ClientContext::range () const
+{
+	/* -1 stands for "no limit" */
+	ValueVector val = ValueVector ();
+	val.push_back (static_cast<int> (_strip_first));
+	val.push_back (_strip_last == ADDR_NONE ? -1 : static_cast<int> (_strip_last));
+	val.push_back (static_cast<int> (_plugin_first));
+	val.push_back (_plugin_last == ADDR_NONE ? -1 : static_cast<int> (_plugin_last));
+	return val;
+}
+
+void
+ClientContext::queue_output (const NodeState& node_state)
+{
+	ClientState::iterator it = _output_state.find (node_state);
+
+	if (it != _output_state.end ()) {
+		/* not yet written, only the latest value matters */
+		_output_state.erase (it);
+		_output_state.insert (node_state);
+		return;
+	}
+
+	_output_state.insert (node_state);
+	_output_buf.push_back (node_state);
+}
+
+const NodeState&
+ClientContext::next_output () const
+{
+	return *_output_state.find (_output_buf.front ());
+}
+
+void
+ClientContext::pop_output ()
+{
+	_output_state.erase (_output_buf.front ());
+	_output_buf.pop_front ();
+}
+
 std::string
 ClientContext::debug_str ()
 {
@@ -25,14 +25,24 @@
 #include "message.h"
 #include "state.h"
 
-typedef struct lws*                 Client;
-typedef std::list<NodeStateMessage> ClientOutputBuffer;
+typedef struct lws*          Client;
+typedef std::list<NodeState> ClientOutputBuffer;
 
 class ClientContext
 {
 public:
+	enum MessageFormat {
+		JSON,  // one JSON object per text frame
+		Binary // as many NodeStateMessage::serialize_binary () records as fit per frame
+	};
+
 	ClientContext (Client wsi)
-	    : _wsi (wsi){};
+	    : _wsi (wsi)
+	    , _format (JSON)
+	    , _strip_first (0)
+	    , _strip_last (ADDR_NONE)
+	    , _plugin_first (0)
+	    , _plugin_last (ADDR_NONE){};
 	virtual ~ClientContext (){};
 
 	Client wsi () const
@@ -43,11 +53,37 @@ public:
 	bool has_state (const NodeState&);
 	void update_state (const NodeState&);
 
-	ClientOutputBuffer& output_buf ()
+	/* feedback is only sent for strips and plugins within the range
+	 * the client subscribed to, see Node::feedback_range
+	 */
+	bool wants (const NodeState&) const;
+	void set_range (uint32_t strip_first, uint32_t strip_last,
+	                uint32_t plugin_first, uint32_t plugin_last);
+	ValueVector range () const;
+
+	MessageFormat format () const
+	{
+		return _format;
+	}
+
+	void set_format (MessageFormat format)
 	{
-		return _output_buf;
+		_format = format;
 	}
 
+	/* queue a state to be written, if a state for the same node address
+	 * is still pending it is replaced (but keeps its place in the queue)
+	 */
+	void queue_output (const NodeState&);
+
+	bool has_output () const
+	{
+		return !_output_buf.empty ();
+	}
+
+	const NodeState& next_output () const;
+	void             pop_output ();
+
 	std::string debug_str ();
 
 private:
@@ -56,7 +92,14 @@ private:
 	typedef boost::unordered_set<NodeState> ClientState;
 	ClientState                             _state;
 
-	ClientOutputBuffer _output_buf;
+	ClientOutputBuffer _output_buf;   // pending node addresses, in order
+	ClientState        _output_state; // and their latest values
+
+	MessageFormat _format;
+	uint32_t      _strip_first;
+	uint32_t      _strip_last;
+	uint32_t      _plugin_first;
+	uint32_t      _plugin_last;
 };
 
 #endif // client_context_h
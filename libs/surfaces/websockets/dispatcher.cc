@@ -35,7 +35,11 @@ WebsocketsDispatcher::NodeMethodMap
     NODE_METHOD_PAIR (strip_pan)
     NODE_METHOD_PAIR (strip_mute)
     NODE_METHOD_PAIR (strip_plugin_enable)
-    NODE_METHOD_PAIR (strip_plugin_param_value);
+    NODE_METHOD_PAIR (strip_plugin_param_value)
+    NODE_METHOD_PAIR (strip_dsp_load)
+    NODE_METHOD_PAIR (strip_plugin_dsp_load)
+    NODE_METHOD_PAIR (feedback_range)
+    NODE_METHOD_PAIR (message_format);
 
 void
 WebsocketsDispatcher::dispatch (Client client, const NodeStateMessage& msg)
@@ -198,6 +202,128 @@ WebsocketsDispatcher::strip_plugin_param_value_handler (Client client, const Nod
 	}
 }
 
+/* DSP load is only sent on request, writing to the node resets the statistics */
+void
+WebsocketsDispatcher::strip_dsp_load_handler (Client client, const NodeStateMessage& msg)
+{
+	uint32_t                 strip_id = msg.state ().nth_addr (0);
+	boost::shared_ptr<Route> route    = boost::dynamic_pointer_cast<Route> (strips ().nth_strip (strip_id));
+
+	if (!route) {
+		return;
+	}
+
+	if (msg.is_write ()) {
+		route->clear_processor_stats ();
+		return;
+	}
+
+	uint64_t min, max;
+	double   avg, dev;
+
+	if (route->get_processor_stats (min, max, avg, dev)) {
+		AddressVector addr = AddressVector ();
+		addr.push_back (strip_id);
+		update (client, Node::strip_dsp_load, addr, dsp_load_value (min, max, avg, dev));
+	}
+}
+
+void
+WebsocketsDispatcher::strip_plugin_dsp_load_handler (Client client, const NodeStateMessage& msg)
+{
+	uint32_t strip_id  = msg.state ().nth_addr (0);
+	uint32_t plugin_id = msg.state ().nth_addr (1);
+
+	boost::shared_ptr<PluginInsert> insert = strips ().strip_plugin_insert (strip_id, plugin_id);
+
+	if (!insert) {
+		return;
+	}
+
+	if (msg.is_write ()) {
+		insert->clear_stats ();
+		return;
+	}
+
+	uint64_t min, max;
+	double   avg, dev;
+
+	if (insert->get_stats (min, max, avg, dev)) {
+		AddressVector addr = AddressVector ();
+		addr.push_back (strip_id);
+		addr.push_back (plugin_id);
+		update (client, Node::strip_plugin_dsp_load, addr, dsp_load_value (min, max, avg, dev));
+	}
+}
+
+/* Clients may limit feedback to the strips (and plugins of these strips)
+ * they show, val = [first strip, last strip, first plugin, last plugin],
+ * missing or negative values mean no limit.
+ */
+void
+WebsocketsDispatcher::feedback_range_handler (Client client, const NodeStateMessage& msg)
+{
+	ClientContext* ctx = server ().client_context (client);
+
+	if (!ctx) {
+		return;
+	}
+
+	if (msg.is_write ()) {
+		uint32_t range[4] = { 0, ADDR_NONE, 0, ADDR_NONE };
+
+		for (int i = 0; i < 4 && i < msg.state ().n_val (); ++i) {
+			int v = msg.state ().nth_val (i);
+			if (v >= 0) {
+				range[i] = v;
+			}
+		}
+
+		ctx->set_range (range[0], range[1], range[2], range[3]);
+
+		/* (re)send everything in the new range */
+		update_all_nodes (client);
+	} else {
+		update (client, Node::feedback_range, AddressVector (), ctx->range ());
+	}
+}
+
+/* val = ["json"] (default) or ["binary"], see NodeStateMessage::serialize_binary */
+void
+WebsocketsDispatcher::message_format_handler (Client client, const NodeStateMessage& msg)
+{
+	ClientContext* ctx = server ().client_context (client);
+
+	if (!ctx) {
+		return;
+	}
+
+	if (msg.is_write ()) {
+		std::string format = msg.state ().nth_val (0);
+
+		if (format == "binary") {
+			ctx->set_format (ClientContext::Binary);
+		} else if (format == "json") {
+			ctx->set_format (ClientContext::JSON);
+		}
+	}
+
+	update (client, Node::message_format,
+	        std::string (ctx->format () == ClientContext::Binary ? "binary" : "json"));
+}
+
+ValueVector
+WebsocketsDispatcher::dsp_load_value (uint64_t min, uint64_t max, double avg, double dev)
+{
+	/* microseconds per cycle */
+	ValueVector val = ValueVector ();
+	val.push_back ((double)min);
+	val.push_back ((double)max);
+	val.push_back (avg);
+	val.push_back (dev);
+	return val;
+}
+
 void
 WebsocketsDispatcher::update (Client client, std::string node, TypedValue val1)
 {
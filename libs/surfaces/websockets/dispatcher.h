@@ -47,6 +47,12 @@ private:
 	void strip_mute_handler (Client, const NodeStateMessage&);
 	void strip_plugin_enable_handler (Client, const NodeStateMessage&);
 	void strip_plugin_param_value_handler (Client, const NodeStateMessage&);
+	void strip_dsp_load_handler (Client, const NodeStateMessage&);
+	void strip_plugin_dsp_load_handler (Client, const NodeStateMessage&);
+	void feedback_range_handler (Client, const NodeStateMessage&);
+	void message_format_handler (Client, const NodeStateMessage&);
+
+	static ValueVector dsp_load_value (uint64_t, uint64_t, double, double);
 
 	void update (Client, std::string, TypedValue);
 	void update (Client, std::string, uint32_t, TypedValue);
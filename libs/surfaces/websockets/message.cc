@@ -20,6 +20,8 @@
 #include <iostream>
 #endif
 
+#include <cstring>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -103,6 +105,129 @@ NodeStateMessage::NodeStateMessage (void* buf, size_t len)
 	}
 }
 
+namespace {
+
+class BinaryWriter
+{
+public:
+	BinaryWriter (void* buf, size_t len)
+	    : _p (static_cast<uint8_t*> (buf))
+	    , _end (static_cast<uint8_t*> (buf) + len)
+	    , _ok (true){};
+
+	bool ok () const
+	{
+		return _ok;
+	}
+
+	size_t size (void* buf) const
+	{
+		return _p - static_cast<uint8_t*> (buf);
+	}
+
+	void u8 (uint8_t v)
+	{
+		if (_p + 1 > _end) {
+			_ok = false;
+			return;
+		}
+		*_p++ = v;
+	}
+
+	void u16 (uint16_t v)
+	{
+		u8 (v & 0xff);
+		u8 (v >> 8);
+	}
+
+	void u32 (uint32_t v)
+	{
+		u16 (v & 0xffff);
+		u16 (v >> 16);
+	}
+
+	void u64 (uint64_t v)
+	{
+		u32 (v & 0xffffffff);
+		u32 (v >> 32);
+	}
+
+	void bytes (const std::string& s)
+	{
+		if (_p + s.size () > _end) {
+			_ok = false;
+			return;
+		}
+		memcpy (_p, s.data (), s.size ());
+		_p += s.size ();
+	}
+
+private:
+	uint8_t* _p;
+	uint8_t* _end;
+	bool     _ok;
+};
+
+}
+
+size_t
+NodeStateMessage::serialize_binary (void* buf, size_t len) const
+{
+	BinaryWriter w (buf, len);
+
+	const std::string& node = _state.node ();
+	w.u8 (node.size ());
+	w.bytes (node);
+
+	int n_addr = _state.n_addr ();
+	w.u8 (n_addr);
+
+	for (int i = 0; i < n_addr; i++) {
+		w.u32 (_state.nth_addr (i));
+	}
+
+	int n_val = _state.n_val ();
+	w.u8 (n_val);
+
+	for (int i = 0; i < n_val; i++) {
+		TypedValue val = _state.nth_val (i);
+
+		switch (val.type ()) {
+			case TypedValue::Bool:
+				w.u8 ('b');
+				w.u8 (static_cast<bool> (val) ? 1 : 0);
+				break;
+			case TypedValue::Int:
+				w.u8 ('i');
+				w.u32 (static_cast<uint32_t> (static_cast<int> (val)));
+				break;
+			case TypedValue::Double: {
+				double   d = static_cast<double> (val);
+				uint64_t bits;
+				memcpy (&bits, &d, sizeof (bits));
+				w.u8 ('d');
+				w.u64 (bits);
+				break;
+			}
+			case TypedValue::String: {
+				std::string s = static_cast<std::string> (val);
+				if (s.size () > 0xffff) {
+					s.resize (0xffff);
+				}
+				w.u8 ('s');
+				w.u16 (s.size ());
+				w.bytes (s);
+				break;
+			}
+			default:
+				w.u8 ('n');
+				break;
+		}
+	}
+
+	return w.ok () ? w.size (buf) : 0;
+}
+
 size_t
 NodeStateMessage::serialize (void* buf, size_t len) const
 {
@@ -29,6 +29,18 @@ public:
 
 	size_t serialize (void*, size_t) const;
 
+	/* Compact binary form, several messages can be concatenated in one
+	 * websocket frame. All numbers are little endian.
+	 *
+	 *   u8 length of the node name, followed by the name
+	 *   u8 number of addresses, followed by as many u32
+	 *   u8 number of values, each of them a type tag followed by
+	 *      'n' nothing, 'b' u8, 'i' i32, 'd' f64 or 's' u16 length + bytes
+	 *
+	 * @return number of bytes written, 0 if the message does not fit
+	 */
+	size_t serialize_binary (void*, size_t) const;
+
 	bool is_valid () const
 	{
 		return _valid;
@@ -125,14 +125,29 @@ WebsocketsServer::update_client (Client wsi, const NodeState& state, bool force)
 		return;
 	}
 
+	if (!it->second.wants (state)) {
+		return;
+	}
+
 	if (force || !it->second.has_state (state)) {
 		/* write to client only if state was updated */
 		it->second.update_state (state);
-		it->second.output_buf ().push_back (NodeStateMessage (state));
+		it->second.queue_output (state);
 		lws_callback_on_writable (wsi);
 	}
 }
 
+ClientContext*
+WebsocketsServer::client_context (Client wsi)
+{
+	ClientContextMap::iterator it = _client_ctx.find (wsi);
+	if (it == _client_ctx.end ()) {
+		return 0;
+	}
+
+	return &it->second;
+}
+
 void
 WebsocketsServer::update_all_clients (const NodeState& state, bool force)
 {
@@ -268,29 +283,58 @@ WebsocketsServer::write_client (Client wsi)
 		return;
 	}
 
-	ClientOutputBuffer& pending = it->second.output_buf ();
-	if (pending.empty ()) {
+	ClientContext& ctx = it->second;
+	if (!ctx.has_output ()) {
 		return;
 	}
 
 	/* one lws_write() call per LWS_CALLBACK_SERVER_WRITEABLE callback */
 
-	NodeStateMessage msg = pending.front ();
-	pending.pop_front ();
-
 	unsigned char out_buf[1024];
-	size_t        len = msg.serialize (out_buf + LWS_PRE, 1024 - LWS_PRE);
 
-	if (len > 0) {
+	if (ctx.format () == ClientContext::Binary) {
+		/* pack as many messages as fit into one frame */
+		size_t len = 0;
+
+		while (ctx.has_output ()) {
+			NodeStateMessage msg (ctx.next_output ());
+			size_t           n = msg.serialize_binary (out_buf + LWS_PRE + len, 1024 - LWS_PRE - len);
+
+			if (n == 0) {
+				if (len == 0) {
+					PBD::error << "ArdourWebsockets: cannot serialize message" << endmsg;
+					ctx.pop_output ();
+				}
+				break;
+			}
+
 #ifndef NDEBUG
-		std::cerr << "TX " << msg.state ().debug_str () << std::endl;
+			std::cerr << "TX " << msg.state ().debug_str () << std::endl;
 #endif
-		lws_write (wsi, out_buf + LWS_PRE, len, LWS_WRITE_TEXT);
+			len += n;
+			ctx.pop_output ();
+		}
+
+		if (len > 0) {
+			lws_write (wsi, out_buf + LWS_PRE, len, LWS_WRITE_BINARY);
+		}
 	} else {
-		PBD::error << "ArdourWebsockets: cannot serialize message" << endmsg;
+		NodeStateMessage msg (ctx.next_output ());
+		ctx.pop_output ();
+
+		size_t len = msg.serialize (out_buf + LWS_PRE, 1024 - LWS_PRE);
+
+		if (len > 0) {
+#ifndef NDEBUG
+			std::cerr << "TX " << msg.state ().debug_str () << std::endl;
+#endif
+			lws_write (wsi, out_buf + LWS_PRE, len, LWS_WRITE_TEXT);
+		} else {
+			PBD::error << "ArdourWebsockets: cannot serialize message" << endmsg;
+		}
 	}
 
-	if (!pending.empty ()) {
+	if (ctx.has_output ()) {
 		lws_callback_on_writable (wsi);
 	}
 }
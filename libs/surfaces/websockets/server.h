@@ -60,6 +60,8 @@ public:
 	void update_client (Client, const NodeState&, bool);
 	void update_all_clients (const NodeState&, bool);
 
+	ClientContext* client_context (Client);
+
 private:
 	struct lws_protocols             _lws_proto[2];
 	struct lws_context_creation_info _lws_info;
@@ -41,6 +41,10 @@ namespace Node
 	const std::string strip_plugin_enable      = "strip_plugin_enable";
 	const std::string strip_plugin_param_desc  = "strip_plugin_param_desc";
 	const std::string strip_plugin_param_value = "strip_plugin_param_value";
+	const std::string strip_dsp_load           = "strip_dsp_load";
+	const std::string strip_plugin_dsp_load    = "strip_plugin_dsp_load";
+	const std::string feedback_range           = "feedback_range";
+	const std::string message_format           = "message_format";
 } // namespace Node
 
 typedef std::vector<uint32_t>   AddressVector;
@@ -66,6 +66,7 @@ bool WaveView::_global_logscaled = false;
 WaveView::Shape WaveView::_global_shape = WaveView::Normal;
 bool WaveView::_global_show_waveform_clipping = true;
 double WaveView::_global_clip_level = 0.98853;
+WaveView::PendingViews WaveView::_pending_views;
 
 PBD::Signal0<void> WaveView::VisualPropertiesChanged;
 PBD::Signal0<void> WaveView::ClipLevelChanged;
@@ -122,6 +123,21 @@ WaveView::init ()
 
 WaveView::~WaveView ()
 {
+	_pending_views.erase (this);
+
+	if (current_request && !current_request->stopped () && !current_request->finished ()) {
+		/* as in cancel_offscreen_requests (): other WaveViews of the
+		 * same source may have found this image in the cache and wait
+		 * for it, only cancel if nobody else uses it, and then make
+		 * sure the unfinished image is not found later on.
+		 */
+		if (current_request->image.use_count () <= 2) {
+			current_request->cancel ();
+			get_cache_group ()->remove_image (current_request->image);
+		}
+	}
+	current_request.reset ();
+
 #ifdef ENABLE_THREADED_WAVEFORM_RENDERING
 	WaveViewThreads::deinitialize ();
 #endif
@@ -343,6 +359,11 @@ WaveView::queue_draw_request (boost::shared_ptr<WaveViewDrawRequest> const& requ
 		current_request->cancel ();
 	}
 
+	/* new requests are queued when scrolling or zooming, which is also
+	 * when queued requests of other WaveViews may have become obsolete.
+	 */
+	cancel_offscreen_requests ();
+
 	boost::shared_ptr<WaveViewImage> cached_image =
 	    get_cache_group ()->lookup_image (request->image->props);
 
@@ -363,6 +384,61 @@ WaveView::queue_draw_request (boost::shared_ptr<WaveViewDrawRequest> const& requ
 
 		WaveViewThreads::enqueue_draw_request (current_request);
 	}
+
+	_pending_views.insert (this);
+}
+
+bool
+WaveView::request_in_view (WaveViewDrawRequest const& req) const
+{
+	Rect const visible = _canvas->visible_area ();
+	Rect const self = item_to_window (Rect (0.0, 0.0, region_length () / _props->samples_per_pixel, _props->height));
+
+	if (self.y1 < visible.y0 || self.y0 > visible.y1) {
+		return false;
+	}
+
+	WaveViewProperties const& props (req.image->props);
+
+	/* keep images that are up to a page away, they are likely to
+	 * be needed when scrolling back and forth.
+	 */
+	const double margin = visible.width ();
+	const double x0 = self.x0 + (props.get_sample_start () - _props->region_start) / props.samples_per_pixel;
+	const double x1 = self.x0 + (props.get_sample_end () - _props->region_start) / props.samples_per_pixel;
+
+	return x1 >= visible.x0 - margin && x0 <= visible.x1 + margin;
+}
+
+void
+WaveView::cancel_offscreen_requests ()
+{
+	for (PendingViews::iterator i = _pending_views.begin (); i != _pending_views.end ();) {
+		WaveView const* wv = *i;
+		boost::shared_ptr<WaveViewDrawRequest> req = wv->current_request;
+
+		if (!req || req->stopped () || req->finished ()) {
+			_pending_views.erase (i++);
+			continue;
+		}
+
+		/* an image that is shared with the request of another
+		 * WaveView (use count: cache + both requests) may still be
+		 * needed there.
+		 */
+		if (req->image.use_count () <= 2 && !wv->request_in_view (*req)) {
+			req->cancel ();
+			/* the unfinished image must not be found in the cache, it would
+			 * never be drawn.
+			 */
+			wv->get_cache_group ()->remove_image (req->image);
+			wv->current_request.reset ();
+			_pending_views.erase (i++);
+			continue;
+		}
+
+		++i;
+	}
 }
 
 void
@@ -139,6 +139,18 @@ WaveViewCacheGroup::add_image (boost::shared_ptr<WaveViewImage> image)
 	_parent_cache.increase_size (image->size_in_bytes ());
 }
 
+void
+WaveViewCacheGroup::remove_image (boost::shared_ptr<WaveViewImage> image)
+{
+	for (ImageCache::iterator it = _cached_images.begin (); it != _cached_images.end (); ++it) {
+		if ((*it) == image) {
+			_parent_cache.decrease_size (image->size_in_bytes ());
+			_cached_images.erase (it);
+			return;
+		}
+	}
+}
+
 boost::shared_ptr<WaveViewImage>
 WaveViewCacheGroup::lookup_image (WaveViewProperties const& props)
 {
@@ -21,6 +21,8 @@
 #ifndef _WAVEVIEW_WAVE_VIEW_H_
 #define _WAVEVIEW_WAVE_VIEW_H_
 
+#include <set>
+
 #include <boost/shared_ptr.hpp>
 #include <boost/scoped_ptr.hpp>
 
@@ -206,6 +208,12 @@ private:
 
 	mutable boost::shared_ptr<WaveViewDrawRequest> current_request;
 
+	/** WaveViews that have a request queued for a drawing thread.
+	 * Only used in the GUI thread.
+	 */
+	typedef std::set<WaveView const*> PendingViews;
+	static PendingViews _pending_views;
+
 	PBD::ScopedConnectionList invalidation_connection;
 
 	static double _global_gradient_depth;
@@ -250,6 +258,15 @@ private:
 
 	void queue_draw_request (boost::shared_ptr<WaveViewDrawRequest> const&) const;
 
+	/** @return true if the image of @a req is within a page of the visible canvas area */
+	bool request_in_view (WaveViewDrawRequest const& req) const;
+
+	/** Cancel queued requests of all WaveViews for images that have
+	 * gone off-screen, so that the drawing threads only render what
+	 * may still be needed.
+	 */
+	static void cancel_offscreen_requests ();
+
 	static void process_draw_request (boost::shared_ptr<WaveViewDrawRequest>);
 
 	boost::shared_ptr<WaveViewCacheGroup> get_cache_group () const;
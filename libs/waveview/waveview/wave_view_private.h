@@ -232,6 +232,8 @@ public:
 
 	void add_image (boost::shared_ptr<WaveViewImage>);
 
+	void remove_image (boost::shared_ptr<WaveViewImage>);
+
 	bool full () const { return _cached_images.size() > max_size(); }
 
 	static uint32_t max_size () { return 16; }
@@ -31,8 +31,6 @@ using namespace ArdourZita;
 VMResampler::VMResampler (void)
 	: _table (0)
   , _buff  (0)
-  , _c1 (0)
-  , _c2 (0)
 {
 	reset ();
 }
@@ -65,8 +63,6 @@ VMResampler::setup (unsigned int hlen, double frel)
 	if (T) {
 		_table = T;
 		_buff  = new float [2 * h - 1 + k];
-		_c1 = new float [2 * h];
-		_c2 = new float [2 * h];
 		_inmax = k;
 		_pstep = s;
 		_qstep = s;
@@ -81,11 +77,7 @@ VMResampler::clear (void)
 {
 	Resampler_table::destroy (_table);
 	delete[] _buff;
-	delete[] _c1;
-	delete[] _c2;
 	_buff  = 0;
-	_c1 = 0;
-	_c2 = 0;
 	_table = 0;
 	_inmax = 0;
 	_pstep = 0;
@@ -233,14 +225,17 @@ VMResampler::process (void)
 				const float aa = 1.0f - bb;
 				float const* cq1 = _table->_ctab + hl * k;
 				float const* cq2 = _table->_ctab + hl * (np - k);
-				for (int i = 0; i < hl; i++) {
-					_c1 [i] = aa * cq1 [i] + bb * cq1 [i + hl];
-					_c2 [i] = aa * cq2 [i] + bb * cq2 [i - hl];
-				}
 
+				/* interpolate the filter coefficients and apply them
+				 * in a single pass, without storing them. The loop
+				 * has no dependencies other than the sum, which the
+				 * compiler only vectorizes because this library is
+				 * built with -ffast-math (reordering the additions).
+				 */
 				a = 1e-25f;
 				for (int i = 0; i < hl; i++) {
-					a += p1[i] * _c1 [i] + p2[-i-1] * _c2 [i];
+					a += p1[i]     * (aa * cq1 [i] + bb * cq1 [i + hl])
+					   + p2[-i-1] * (aa * cq2 [i] + bb * cq2 [i - hl]);
 				}
 				*out_data++ = a - 1e-25f;
 			}
@@ -44,6 +44,11 @@
         }
     };
 
+    conn.openCallback = () => {
+        // compact framing, several updates per websocket frame
+        conn.send('message_format', [], ['binary']);
+    };
+
     conn.closeCallback = () => {
         log('Connection dropped', 'error');
     };
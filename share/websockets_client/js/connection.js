@@ -22,6 +22,7 @@ class Connection {
 
     constructor (host, port) {
         this.socket = new WebSocket(`ws://${host}:${port}`);
+        this.socket.binaryType = 'arraybuffer';
         this.socket.onopen = () => this.openCallback();
         this.socket.onclose = () => this.closeCallback();
         this.socket.onerror = (error) => this.errorCallback(error);
@@ -59,6 +60,11 @@ class Connection {
     }
 
     _onMessage (event) {
+        if (event.data instanceof ArrayBuffer) {
+            this._onBinaryMessage(event.data);
+            return;
+        }
+
         const msg = JSON.parse(event.data);
 
         for (const i in msg.val) {
@@ -72,4 +78,54 @@ class Connection {
         this.messageCallback(msg.node, msg.addr || [], msg.val);
     }
 
+    // see NodeStateMessage::serialize_binary() in libs/surfaces/websockets/message.h
+    _onBinaryMessage (data) {
+        const view = new DataView(data);
+        const decoder = new TextDecoder();
+        let offset = 0;
+
+        const string = (len) => {
+            const s = decoder.decode(new Uint8Array(data, offset, len));
+            offset += len;
+            return s;
+        };
+
+        while (offset < view.byteLength) {
+            const node = string(view.getUint8(offset++));
+
+            const addr = [];
+            const nAddr = view.getUint8(offset++);
+
+            for (let i = 0; i < nAddr; i++) {
+                addr.push(view.getUint32(offset, true));
+                offset += 4;
+            }
+
+            const val = [];
+            const nVal = view.getUint8(offset++);
+
+            for (let i = 0; i < nVal; i++) {
+                const type = String.fromCharCode(view.getUint8(offset++));
+
+                if (type == 'b') {
+                    val.push(view.getUint8(offset++) != 0);
+                } else if (type == 'i') {
+                    val.push(view.getInt32(offset, true));
+                    offset += 4;
+                } else if (type == 'd') {
+                    val.push(view.getFloat64(offset, true));
+                    offset += 8;
+                } else if (type == 's') {
+                    const len = view.getUint16(offset, true);
+                    offset += 2;
+                    val.push(string(len));
+                } else {
+                    val.push(null);
+                }
+            }
+
+            this.messageCallback(node, addr, val);
+        }
+    }
+
 }